@@ -2,8 +2,18 @@
 #define DELYNOI_CONFIG_H
 
 #include <utilities/Precision.h>
+
+/*
+ * Orderings that can be applied to the points and elements of a mesh: the order in which they were created, or the
+ * order in which a space filling curve (Hilbert or Morton) visits them, which keeps close in memory the entities that
+ * are close in space
+ */
+enum class MeshOrdering {Original, Hilbert, Morton};
+
 /* This class contains all global configuration parameters of the Delynoi
- * library, which default values can be changed by the user*/
+ * library, which default values can be changed by the user. Each thread uses the process wide default instance unless
+ * another one (usually a copy, with different values) is activated for it, so independent problems can run
+ * concurrently with different parameters*/
 class DelynoiConfig {
 private:
     /*
@@ -26,7 +36,25 @@ private:
      */
     int precision;
 
-    static DelynoiConfig* s_instance;
+    /*
+     * Number of threads used by the algorithms that can run in parallel (one means serial, zero one per core)
+     */
+    int number_of_threads;
+
+    /*
+     * Ordering applied to the points and elements of the meshes created by the generators or read from files
+     */
+    MeshOrdering mesh_ordering;
+
+    /*
+     * Whether meshes and results are written with the numbering the points and elements had before being reordered
+     */
+    bool original_numbering;
+
+    /*
+     * Configuration activated for the calling thread (null when the thread uses the default one)
+     */
+    static thread_local DelynoiConfig* active;
 
     /*
      * Constructor. Sets the default parameter value.
@@ -34,14 +62,20 @@ private:
     DelynoiConfig();
 
     /*
-     * Deletes the copy constructor following the singleton pattern
+     * @return the process wide default instance
      */
-    DelynoiConfig(const DelynoiConfig& other) = delete;
-    /*
-    * Deletes the assignment operator following the singleton pattern
-    */
-    DelynoiConfig& operator=(const DelynoiConfig& copy) = delete;
+    static DelynoiConfig* defaultInstance();
 public:
+    /*
+     * Copy constructor, used to create independent configurations that can be activated per thread
+     */
+    DelynoiConfig(const DelynoiConfig& other) = default;
+
+    /*
+     * Assignment operator
+     */
+    DelynoiConfig& operator=(const DelynoiConfig& other) = default;
+
     /*
      * Sets the value of the circle discretization grade
      * @param d new value
@@ -72,15 +106,37 @@ public:
      */
     void setPrecision(int p);
 
+    /*
+     * Sets the number of threads used by the parallel algorithms (the conversion from Delaunay to Voronoi)
+     * @param n new value (one for serial execution, zero to use one thread per core)
+     */
+    void setNumberOfThreads(int n);
+
+    /*
+     * Sets the ordering applied to the points and elements of the generated meshes and of the meshes read from files
+     * (Hilbert by default; Original keeps the order in which they are created, and setOriginalNumbering keeps that
+     * numbering in the output while the computations use the reordered mesh)
+     * @param o new value
+     */
+    void setMeshOrdering(MeshOrdering o);
+
+    /*
+     * Sets whether meshes and results are written with the numbering previous to the reordering
+     * @param o new value
+     */
+    void setOriginalNumbering(bool o);
+
     /*
      * @return value of the circle discretization grade
      */
     int getDiscretizationGrade();
 
     /*
-     * @return the double comparison tolerance value
+     * @return the double comparison tolerance value. Inline, as it is used in every Point comparison
      */
-    double getTolerance();
+    double getTolerance(){
+        return this->double_comparison_tolerance;
+    }
 
     /*
      * @return the value of the scale used for Clipper
@@ -93,9 +149,32 @@ public:
     int getPrecision();
 
     /*
-     * @return the DelynoiConfig instance
+     * @return the number of threads used by the parallel algorithms (zero means one per core)
+     */
+    int getNumberOfThreads();
+
+    /*
+     * @return the ordering applied to the points and elements of the generated meshes
+     */
+    MeshOrdering getMeshOrdering();
+
+    /*
+     * @return whether meshes and results are written with the numbering previous to the reordering
+     */
+    bool useOriginalNumbering();
+
+    /*
+     * @return the DelynoiConfig instance used by the calling thread
+     */
+    static DelynoiConfig* instance(){
+        return active!=nullptr? active : defaultInstance();
+    }
+
+    /* Activates a configuration for the calling thread. The instance must outlive its activation
+     * @param config configuration to activate (null to go back to the default one)
+     * @return the previously activated configuration (null if it was the default one)
      */
-    static DelynoiConfig* instance();
+    static DelynoiConfig* activate(DelynoiConfig* config);
 };
 
 
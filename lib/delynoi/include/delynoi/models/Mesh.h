@@ -3,9 +3,16 @@
 
 #include <delynoi/models/neighbourhood/SegmentMap.h>
 #include <utilities/UniqueList.h>
+#include <utilities/BufferedWriter.h>
+#include <utilities/Profiler.h>
 #include <fstream>
 #include <delynoi/models/polygon/Polygon.h>
 #include <delynoi/models/neighbourhood/PointMap.h>
+#include <delynoi/models/neighbourhood/MeshTopology.h>
+#include <delynoi/models/PointLocator.h>
+#include <delynoi/utilities/spaceFillingCurve.h>
+#include <delynoi/config/DelynoiConfig.h>
+#include <memory>
 #include <delynoi/models/polygon/Triangle.h>
 
 /*
@@ -30,6 +37,30 @@ protected:
      * List of elements of the mesh
      */
     std::vector<T> polygons;
+
+    /*
+     * Index based neighbourhood information, built from the elements the first time it is requested
+     */
+    std::shared_ptr<MeshTopology> topology;
+
+    /*
+     * Point location structure, built from the points and the topology the first time it is requested
+     */
+    std::shared_ptr<PointLocator> locator;
+
+    /*
+     * Original index of each point and element, if the mesh was reordered (empty if it keeps the original numbering)
+     */
+    std::vector<int> pointPermutation;
+    std::vector<int> polygonPermutation;
+
+    /* Gets the topology used to write the mesh: the one of the mesh, or, if the original numbering is to be kept, one
+     * built from the elements in their original order and with the original point indexes
+     * @param pointOrder vector where the index of the point written in each position is set (empty if the points are
+     * written in their current order)
+     * @return topology whose cells and edges are written
+     */
+    std::shared_ptr<MeshTopology> outputTopology(std::vector<int>& pointOrder);
 public:
     /*
      * Default constructor
@@ -51,24 +82,36 @@ public:
      */
     Mesh(const Mesh& m);
 
+    /*
+     * Copy assignment. As the copy constructor, shares the neighbourhood maps of the assigned mesh
+     */
+    Mesh& operator=(const Mesh& m) = default;
+
     /* Prints the mesh contents in a file stream
      * @param file file stream to print the mesh
      */
     void printInStream(std::ofstream& file);
 
+    /* Prints the mesh contents using a buffered writer, which is considerably faster than going through std::ofstream
+     * for large meshes
+     * @param writer buffered writer to print the mesh
+     */
+    void printInStream(BufferedWriter& writer);
+
     /* Print the mesh contents in a file
      * @param fileName name of the file to print
      */
     void printInFile(std::string fileName);
 
-    /* Creates the mesh (fill its contents) from a file
+    /* Creates the mesh (fill its contents) from a file, and reorders it with the ordering set in DelynoiConfig
      * @param fileName name of the file to read
      * @param startIndex Index to start reading the informtion (so to be compatible with both zero and one-indexed
      * standards)
      */
     void createFromFile(std::string fileName, int startIndex);
 
-    /* Creates the mesh (fill its contents) from a file
+    /* Creates the mesh (fill its contents) from a file, keeping the numbering of the file (so the caller can read more
+     * data that refers to it before reordering)
      * @param ofstream stream from which the mesh will be read
      * @param startIndex Index to start reading the informtion (so to be compatible with both zero and one-indexed
      * standards)
@@ -122,6 +165,46 @@ public:
      * @return all incident polygons to s
      */
     NeighboursBySegment getNeighbours(IndexSegment s);
+
+    /* Gets the index based topology of the mesh (cell, edge and vertex neighbourhood). It is built from the elements
+     * the first time it is requested, so resetTopology must be called if the elements are modified afterwards. Not
+     * thread safe when called for the first time
+     * @return topology of the mesh
+     */
+    MeshTopology& getTopology();
+
+    /*
+     * Discards the topology (and the point locator, which depends on it), so that they are built again from the current
+     * elements when requested
+     */
+    void resetTopology();
+
+    /* Gets the point location structure of the mesh, used to find the elements that contain arbitrary points. It is
+     * built the first time it is requested, so resetTopology must be called if the points or the elements are modified
+     * afterwards. Not thread safe when called for the first time
+     * @return point locator of the mesh
+     */
+    PointLocator& getLocator();
+
+    /* Reorders the points and the elements of the mesh along a space filling curve (the points by their position, the
+     * elements by the average of their vertices), so that entities close in space are also close in memory and the
+     * loops over the elements access the points with more locality. The neighbourhood maps are renumbered, and the
+     * original indexes are kept so the results can be written with the original numbering. Anything that refers to the
+     * points or the elements by index (for example, the constraints of a problem) must be created after reordering. As
+     * the maps are renumbered in place, copies of the mesh that share them must not be used after reordering
+     * @param ordering space filling curve to follow (Original leaves the mesh as it is)
+     */
+    void reorder(MeshOrdering ordering);
+
+    /*
+     * @return original index of each point, empty if the points were not reordered
+     */
+    const std::vector<int>& getPointPermutation() const;
+
+    /*
+     * @return original index of each element, empty if the elements were not reordered
+     */
+    const std::vector<int>& getPolygonPermutation() const;
 };
 
 
@@ -153,6 +236,10 @@ Mesh<T>::Mesh(const Mesh &m) {
     this->polygons = m.getPolygons();
     this->edges = m.getSegments();
     this->pointMap = m.getPointMap();
+    this->topology = m.topology;
+    this->locator = m.locator;
+    this->pointPermutation = m.pointPermutation;
+    this->polygonPermutation = m.polygonPermutation;
 }
 
 template <typename T>
@@ -162,10 +249,14 @@ void Mesh<T>::createFromFile(std::string fileName, int startIndex) {
     createFromStream(infile, startIndex);
 
     infile.close();
+    reorder(DelynoiConfig::instance()->getMeshOrdering());
 }
 
 template <typename T>
 void Mesh<T>::createFromStream(std::ifstream &infile, int startIndex) {
+    resetTopology();
+    this->pointPermutation.clear();
+    this->polygonPermutation.clear();
     std::string line;
     std::getline(infile, line);
     int numberMeshPoints = std::atoi(line.c_str());
@@ -202,15 +293,13 @@ void Mesh<T>::createFromStream(std::ifstream &infile, int startIndex) {
 
 template <typename T>
 void Mesh<T>::printInFile(std::string fileName) {
+    PROFILE_PHASE("output");
     std::string path = utilities::getPath();
     path +=  fileName;
 
-    std::ofstream file;
-    file.open(path, std::ios::out);
-    file << std::fixed << std::setprecision(DelynoiConfig::instance()->getPrecision());
-
-    printInStream(file);
-    file.close();
+    BufferedWriter writer(path);
+    printInStream(writer);
+    writer.close();
 }
 
 template <typename T>
@@ -230,23 +319,105 @@ T& Mesh<T>::getPolygon(int index) {
 
 template <typename T>
 void Mesh<T>::printInStream(std::ofstream &file) {
-    file << points.size() << std::endl;
+    std::vector<int> pointOrder;
+    std::shared_ptr<MeshTopology> topology = outputTopology(pointOrder);
+
+    file << points.size() << '\n';
+    for(int i=0;i<points.size();i++){
+        file << points[pointOrder.empty()? i : pointOrder[i]].getString() << '\n';
+    }
+
+    file << topology->getNumberOfEdges() << '\n';
+    for (int e = 0; e < topology->getNumberOfEdges(); ++e) {
+        file << topology->getEdge(e).getString() << '\n';
+    }
+
+    file << topology->getNumberOfCells() << '\n';
+    for(int i=0;i<topology->getNumberOfCells();i++){
+        IndexRange cell = topology->cellVertices(i);
+
+        file << utilities::toString<double>(cell.size());
+        for(int point: cell){
+            file << " " << utilities::toString<double>(point);
+        }
+        file << '\n';
+    }
+}
+
+template <typename T>
+void Mesh<T>::printInStream(BufferedWriter &writer) {
+    std::vector<int> pointOrder;
+    std::shared_ptr<MeshTopology> topology = outputTopology(pointOrder);
+
+    writer.write(points.size());
+    writer.write('\n');
     for(int i=0;i<points.size();i++){
-        file << points[i].getString() << std::endl;
+        Point& point = points[pointOrder.empty()? i : pointOrder[i]];
+
+        writer.write(point.getX());
+        writer.write(' ');
+        writer.write(point.getY());
+        writer.write('\n');
     }
 
-    file << this->edges->size() << std::endl;
-    for(auto e: this->edges->getMap()){
-        IndexSegment edge = e.first;
-        file << edge.getString() << std::endl;
+    writer.write(topology->getNumberOfEdges());
+    writer.write('\n');
+    for (int e = 0; e < topology->getNumberOfEdges(); ++e) {
+        IndexSegment edge = topology->getEdge(e);
+        writer.write(edge.getFirst());
+        writer.write(' ');
+        writer.write(edge.getSecond());
+        writer.write('\n');
     }
 
-    file << this->polygons.size() << std::endl;
-    for(int i=0;i<this->polygons.size();i++){
-        file << this->polygons[i].getString() << std::endl;
+    writer.write(topology->getNumberOfCells());
+    writer.write('\n');
+    for(int i=0;i<topology->getNumberOfCells();i++){
+        IndexRange cell = topology->cellVertices(i);
+
+        writer.write(cell.size());
+        for(int point: cell){
+            writer.write(' ');
+            writer.write(point);
+        }
+        writer.write('\n');
     }
 }
 
+template <typename T>
+std::shared_ptr<MeshTopology> Mesh<T>::outputTopology(std::vector<int> &pointOrder) {
+    if(this->pointPermutation.empty() || !DelynoiConfig::instance()->useOriginalNumbering()){
+        pointOrder.clear();
+        getTopology();
+
+        return this->topology;
+    }
+
+    int n = this->points.size();
+    int m = (int) this->polygons.size();
+
+    pointOrder.resize(n);
+    for (int i = 0; i < n; ++i) {
+        pointOrder[this->pointPermutation[i]] = i;
+    }
+
+    std::vector<int> polygonOrder(m);
+    for (int i = 0; i < m; ++i) {
+        polygonOrder[this->polygonPermutation[i]] = i;
+    }
+
+    std::vector<int> cellOffsets(1, 0);
+    std::vector<int> cellVertices;
+    for (int i = 0; i < m; ++i) {
+        for(int point: this->polygons[polygonOrder[i]].getPoints()){
+            cellVertices.push_back(this->pointPermutation[point]);
+        }
+        cellOffsets.push_back((int) cellVertices.size());
+    }
+
+    return std::make_shared<MeshTopology>(n, cellOffsets, cellVertices);
+}
+
 template <typename T>
 SegmentMap* Mesh<T>::getSegments() const{
     return this->edges;
@@ -277,4 +448,126 @@ NeighboursBySegment Mesh<T>::getNeighbours(IndexSegment s) {
     return this->edges->get(s);
 }
 
+template <typename T>
+MeshTopology& Mesh<T>::getTopology() {
+    if(!this->topology){
+        std::vector<int> cellOffsets(1, 0);
+        std::vector<int> cellVertices;
+
+        for(T& polygon: this->polygons){
+            std::vector<int>& polygonPoints = polygon.getPoints();
+            cellVertices.insert(cellVertices.end(), polygonPoints.begin(), polygonPoints.end());
+            cellOffsets.push_back((int) cellVertices.size());
+        }
+
+        this->topology = std::make_shared<MeshTopology>(this->points.size(), cellOffsets, cellVertices);
+    }
+
+    return *this->topology;
+}
+
+template <typename T>
+void Mesh<T>::resetTopology() {
+    this->topology.reset();
+    this->locator.reset();
+}
+
+template <typename T>
+PointLocator& Mesh<T>::getLocator() {
+    if(!this->locator){
+        this->locator = std::make_shared<PointLocator>(this->points.getList(), getTopology());
+    }
+
+    return *this->locator;
+}
+
+template <typename T>
+void Mesh<T>::reorder(MeshOrdering ordering) {
+    if(ordering==MeshOrdering::Original){
+        return;
+    }
+
+    PROFILE_PHASE("mesh reordering");
+    std::vector<Point>& meshPoints = this->points.getList();
+    int n = (int) meshPoints.size();
+    int m = (int) this->polygons.size();
+
+    std::vector<int> pointOrder = delynoi_utilities::curveOrder(meshPoints, ordering);
+    std::vector<int> newPointIndex(n);
+    for (int i = 0; i < n; ++i) {
+        newPointIndex[pointOrder[i]] = i;
+    }
+
+    std::vector<Point> centers;
+    centers.reserve(m);
+    for(T& polygon: this->polygons){
+        centers.push_back(polygon.getAverage(meshPoints));
+    }
+
+    std::vector<int> polygonOrder = delynoi_utilities::curveOrder(centers, ordering);
+    std::vector<int> newPolygonIndex(m);
+    for (int i = 0; i < m; ++i) {
+        newPolygonIndex[polygonOrder[i]] = i;
+    }
+
+    // Points are forced into the new list, so points that are equal within the tolerance keep their own indexes
+    UniqueList<Point> reorderedPoints;
+    for (int i = 0; i < n; ++i) {
+        reorderedPoints.force_push_back(meshPoints[pointOrder[i]]);
+    }
+
+    std::vector<T> reorderedPolygons;
+    reorderedPolygons.reserve(m);
+    for (int i = 0; i < m; ++i) {
+        reorderedPolygons.push_back(this->polygons[polygonOrder[i]]);
+        reorderedPolygons.back().renumberPoints(newPointIndex);
+    }
+
+    // The maps are renumbered in place, as the mesh owns them (copies of the mesh made before reordering share them)
+    auto newNeighbour = [&newPolygonIndex](int polygon){
+        return polygon<0? polygon : newPolygonIndex[polygon];
+    };
+
+    std::unordered_map<IndexSegment,NeighboursBySegment,SegmentHasher> reorderedEdges;
+    reorderedEdges.reserve(this->edges->getMap().size());
+    for(auto& entry: this->edges->getMap()){
+        IndexSegment segment(newPointIndex[entry.first.getFirst()], newPointIndex[entry.first.getSecond()]);
+        reorderedEdges.insert(std::make_pair(segment, NeighboursBySegment(newNeighbour(entry.second.getFirst()),
+                                                                          newNeighbour(entry.second.getSecond()))));
+    }
+    this->edges->getMap().swap(reorderedEdges);
+
+    for(auto& entry: this->pointMap->getMap()){
+        for(int& neighbour: entry.second.getNeighbours()){
+            neighbour = newNeighbour(neighbour);
+        }
+    }
+
+    // Permutations are composed, so they always refer to the numbering the mesh was created with
+    std::vector<int> pointPermutation(n), polygonPermutation(m);
+    for (int i = 0; i < n; ++i) {
+        pointPermutation[i] = this->pointPermutation.empty()? pointOrder[i] : this->pointPermutation[pointOrder[i]];
+    }
+    for (int i = 0; i < m; ++i) {
+        polygonPermutation[i] = this->polygonPermutation.empty()? polygonOrder[i] :
+                                this->polygonPermutation[polygonOrder[i]];
+    }
+
+    this->points = reorderedPoints;
+    this->polygons.swap(reorderedPolygons);
+    this->pointPermutation.swap(pointPermutation);
+    this->polygonPermutation.swap(polygonPermutation);
+    resetTopology();
+}
+
+template <typename T>
+const std::vector<int>& Mesh<T>::getPointPermutation() const {
+    return this->pointPermutation;
+}
+
+template <typename T>
+const std::vector<int>& Mesh<T>::getPolygonPermutation() const {
+    return this->polygonPermutation;
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,74 @@
+#ifndef DELYNOI_MESHPARTITIONER_H
+#define DELYNOI_MESHPARTITIONER_H
+
+#include <delynoi/models/Mesh.h>
+#include <delynoi/models/neighbourhood/MeshTopology.h>
+#include <vector>
+
+/*
+ * Result of partitioning a mesh: the part of each element and, for each part, the mesh points it shares with other
+ * parts (its interface nodes), in compressed form: the interface nodes of part p are [interfaceOffsets[p],
+ * interfaceOffsets[p+1]), in increasing order
+ */
+struct MeshPartition {
+    int numberOfParts = 0;
+    std::vector<int> parts;
+    std::vector<int> interfaceOffsets;
+    std::vector<int> interfaceNodes;
+
+    /*
+     * Number of mesh edges shared by elements of different parts
+     */
+    int edgeCut = 0;
+};
+
+/*
+ * Multilevel k-way partitioner of the dual graph of a mesh (elements joined by the edges they share). The graph is
+ * coarsened by heavy edge matching until it has a few vertices per part, partitioned there by recursive bisection (each
+ * half grown greedily from a peripheral vertex), and the partition is projected back level by level, improved at each
+ * one by Fiduccia-Mattheyses passes (moves of boundary elements by decreasing gain, keeping the best prefix of moves).
+ * Parts are kept within the imbalance tolerance of the average weight. The algorithm is deterministic: the same mesh
+ * always gives the same partition
+ */
+class MeshPartitioner {
+private:
+    /*
+     * Maximum relative excess of weight of a part over the average
+     */
+    double imbalance;
+
+    /*
+     * Maximum number of refinement passes on each level
+     */
+    int refinementPasses;
+public:
+    /*
+     * Constructor
+     * @param imbalance maximum relative excess of weight of a part over the average (0.03 allows 3% more)
+     * @param refinementPasses maximum number of refinement passes on each level
+     */
+    explicit MeshPartitioner(double imbalance = 0.03, int refinementPasses = 8);
+
+    /* Partitions the elements of a mesh
+     * @param topology topology of the mesh
+     * @param numberOfParts number of parts
+     * @param weights weight of each element (for example, its expected work), empty to give all elements the same
+     * @return part of each element and interface nodes of each part
+     */
+    MeshPartition partition(const MeshTopology& topology, int numberOfParts,
+                            const std::vector<int>& weights = std::vector<int>()) const;
+
+    /* Partitions the elements of a mesh
+     * @param mesh mesh to partition
+     * @param numberOfParts number of parts
+     * @param weights weight of each element, empty to give all elements the same
+     * @return part of each element and interface nodes of each part
+     */
+    template <typename T>
+    MeshPartition partition(Mesh<T>& mesh, int numberOfParts,
+                            const std::vector<int>& weights = std::vector<int>()) const {
+        return partition(mesh.getTopology(), numberOfParts, weights);
+    }
+};
+
+#endif
@@ -0,0 +1,138 @@
+#ifndef DELYNOI_POINTLOCATOR_H
+#define DELYNOI_POINTLOCATOR_H
+
+#include <delynoi/models/basic/Point.h>
+#include <delynoi/models/neighbourhood/MeshTopology.h>
+#include <vector>
+
+/*
+ * Result of locating several points in a mesh: the element that contains each point (-1 if no element does) and the
+ * interpolation coordinates of the point in that element, one per element vertex (in the order of the element), in
+ * compressed form: the coordinates of point i are [offsets[i], offsets[i+1])
+ */
+struct PointLocations {
+    std::vector<int> elements;
+    std::vector<int> offsets;
+    std::vector<double> coordinates;
+};
+
+/*
+ * Point location structure of a mesh. The bounding box of the mesh is divided in a uniform grid (about one element per
+ * cell), and each cell lists the elements whose bounding box touches it, in increasing order. A point is located by
+ * testing the elements listed in its cell; when a hint is given (for example, the element of the previous point in a
+ * sequence of nearby points), a few steps are first walked from it through the edge neighbours of the mesh. Points on
+ * the boundary of several elements are always assigned to the one with the lowest index, so the result does not depend
+ * on the hint. The containment test is the same as Polygon::containsPoint, so points on the edges are inside.
+ * Interpolation coordinates are mean value coordinates, which are the barycentric coordinates on triangles, linear on
+ * the edges and exact for linear functions on any element
+ */
+class PointLocator {
+private:
+    /*
+     * Points of the mesh
+     */
+    std::vector<Point> points;
+
+    /*
+     * Elements in compressed form: the vertices of element c (and the neighbours through each of its edges, -1 on the
+     * boundary) are [elementOffsets[c], elementOffsets[c+1])
+     */
+    std::vector<int> elementOffsets;
+    std::vector<int> elementVertices;
+    std::vector<int> elementNeighbours;
+
+    /*
+     * Orientation of each element (1 if counter clockwise, -1 if clockwise)
+     */
+    std::vector<char> orientation;
+
+    /*
+     * Bounding box of each element (xMin, yMin, xMax, yMax), slightly enlarged by the tolerance
+     */
+    std::vector<double> boxes;
+
+    /*
+     * Grid: origin, cell size, number of cells in each axis, and elements of each cell in compressed form
+     */
+    double xMin;
+    double yMin;
+    double cellSize;
+    int nX;
+    int nY;
+    std::vector<int> cellOffsets;
+    std::vector<int> cellElements;
+
+    /*
+     * Cell coordinates of a value (clamped to the grid)
+     */
+    int cellX(double x) const;
+    int cellY(double y) const;
+
+    /* Checks if a point is inside an element (or on its edges)
+     * @param element index of the element
+     * @param p point to check
+     * @return whether the element contains the point
+     */
+    bool contains(int element, const Point& p) const;
+
+    /* Checks if a point is on the edges of an element
+     * @param element index of the element
+     * @param p point to check
+     * @return whether the point is on the edges of the element
+     */
+    bool inEdges(int element, const Point& p) const;
+
+    /* Locates a point testing the elements of its grid cell
+     * @param p point to locate
+     * @return element with the lowest index that contains the point, -1 if none does
+     */
+    int search(const Point& p) const;
+
+    /* Walks from an element towards a point, crossing the edges that have the point on their outer side
+     * @param p point to locate
+     * @param start element to start from
+     * @return element that contains the point, -1 if it was not found in a few steps
+     */
+    int walk(const Point& p, int start) const;
+public:
+    /*
+     * Constructor. Builds the grid from the points and the elements of a mesh
+     * @param points points of the mesh
+     * @param topology topology of the mesh (elements and their edge neighbours)
+     */
+    PointLocator(const std::vector<Point>& points, const MeshTopology& topology);
+
+    /* Finds the element that contains a point
+     * @param p point to locate
+     * @param hint element close to the point, where the search starts (-1 if unknown)
+     * @return element with the lowest index that contains the point, -1 if none does
+     */
+    int locate(const Point& p, int hint = -1) const;
+
+    /* Computes the interpolation (mean value) coordinates of a point in an element
+     * @param element index of the element
+     * @param p point, inside the element
+     * @param coordinates array where the coordinates are set, one per element vertex
+     */
+    void getCoordinates(int element, const Point& p, double* coordinates) const;
+
+    /* Locates several points, in parallel. Each thread walks from the element of the previous point, so points sorted
+     * along a line or a curve are located faster
+     * @param queries points to locate
+     * @param elements vector where the element of each point is set (-1 if no element contains it)
+     */
+    void locate(const std::vector<Point>& queries, std::vector<int>& elements) const;
+
+    /* Locates several points, in parallel, and computes their interpolation coordinates
+     * @param queries points to locate
+     * @param locations elements and coordinates of the points
+     */
+    void locate(const std::vector<Point>& queries, PointLocations& locations) const;
+
+    /*
+     * @return number of vertices of an element
+     */
+    int elementSize(int element) const { return elementOffsets[element + 1] - elementOffsets[element]; }
+};
+
+#endif
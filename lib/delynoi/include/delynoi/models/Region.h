@@ -8,11 +8,14 @@
 #include <algorithm>
 #include <delynoi/utilities/delynoi_utilities.h>
 #include <delynoi/models/generator/PointGenerator.h>
+#include <delynoi/models/generator/PoissonDiskGenerator.h>
 #include <climits>
 #include <delynoi/models/hole/PolygonalHole.h>
 #include <delynoi/models/hole/clipper/lib/clipper.hpp>
 #include <delynoi/models/hole/clipper/ClipperWrapper.h>
 #include <delynoi/config/DelynoiConfig.h>
+#include <delynoi/models/RegionClassifier.h>
+#include <memory>
 
 /*
  * Models a region inside which a mesh can be generated. Region inherits from Polygon (as it is a polygon after all),
@@ -35,8 +38,19 @@ private:
      */
     std::vector<Point> seedPoints;
 
+    /*
+     * Point classifier of the region, built the first time it is needed and discarded when the outline or the holes
+     * change
+     */
+    std::shared_ptr<RegionClassifier> classifier;
+
+    /*
+     * @return classifier of the region (built if needed)
+     */
+    RegionClassifier& getClassifier();
+
     /* Erase from the seed point list all seed points that are not inside the region (as they are generated in the
-     * bounding box of the region)
+     * bounding box of the region) or are inside a hole. Seeds are classified in parallel
      */
     void clean();
 public:
@@ -76,7 +90,9 @@ public:
     std::vector<Point> getRegionPoints();
 
     /*
-     * @return list of holes inside the region
+     * @return list of holes inside the region. As the holes can be modified through the returned reference, the point
+     * classifier of the region is discarded (and rebuilt when it is needed again); holes must not be modified through
+     * a reference obtained before the region is queried
      */
     std::vector<Hole>& getHoles();
 
@@ -99,6 +115,12 @@ public:
      */
     void generateSeedPoints(PointGenerator p, int nX, int nY);
 
+    /* Creates graded seed points inside the region (and outside its holes) using Poisson-disk sampling, with the spacing
+     * given by the size function of the generator
+     * @param generator PoissonDiskGenerator instance to use
+     */
+    void generateSeedPoints(PoissonDiskGenerator generator);
+
     /* Adds already seed points to the list
      * @param seeds list of points to add
      */
@@ -0,0 +1,90 @@
+#ifndef DELYNOI_REGIONCLASSIFIER_H
+#define DELYNOI_REGIONCLASSIFIER_H
+
+#include <delynoi/models/basic/Point.h>
+#include <delynoi/models/hole/Hole.h>
+#include <delynoi/models/polygon/Polygon.h>
+#include <functional>
+#include <vector>
+
+/*
+ * Point in region classifier, built once for the outline and holes of a region. The bounding box of the region is
+ * divided in a grid, and every cell crossed by an edge (of the outline or of a hole, enlarged by the tolerance) is
+ * marked as a boundary cell; the remaining cells are completely inside or outside the region, and they are classified
+ * by components (cells connected without crossing a boundary cell share their state), with a single exact test each.
+ * Points in inside or outside cells are classified in O(1); only points in boundary cells need the exact tests, which
+ * skip the outline when the point is far from it (a second grid is built with the outline only) and the holes whose
+ * bounding box does not contain the point. The results are the same as testing the outline and every hole (points on
+ * the outline are inside the region, points on a hole boundary are not)
+ */
+class RegionClassifier {
+private:
+    /*
+     * State of a grid cell
+     */
+    enum CellState : char { outside, inside, boundary };
+
+    /*
+     * Grid: origin, cell size, number of cells in each axis and state of each cell
+     */
+    double xMin;
+    double yMin;
+    double cellSize;
+    int nX;
+    int nY;
+    std::vector<char> cells;
+
+    /*
+     * State of each cell with respect to the outline only (ignoring the holes), so that points near a hole do not need
+     * to be tested against the whole outline
+     */
+    std::vector<char> outlineCells;
+
+    /*
+     * Outline of the region as a polygon (indexing the outline points), used for the exact tests
+     */
+    Polygon polygon;
+
+    /*
+     * Bounding box of each hole (xMin, yMin, xMax, yMax)
+     */
+    std::vector<double> holeBoxes;
+
+    /* Marks the cells touched by a set of edges as boundary cells, and classifies the remaining ones
+     * @param edges edges (pairs of endpoints)
+     * @param test exact test used on one cell of each component of non boundary cells
+     * @return state of each cell
+     */
+    std::vector<char> rasterize(std::vector<std::pair<Point,Point>>& edges, std::function<bool(Point)> test);
+
+    /*
+     * Cell coordinates of a value (clamped to the grid)
+     */
+    int cellX(double x);
+    int cellY(double y);
+
+    /* Classifies a point with exact tests
+     * @param outline points of the region
+     * @param holes holes of the region
+     * @param p point to classify
+     * @return whether the point is inside the region and outside all holes
+     */
+    bool exactTest(std::vector<Point>& outline, std::vector<Hole>& holes, Point p);
+public:
+    /*
+     * Constructor. Builds the grid
+     * @param outline points of the region
+     * @param holes holes of the region
+     */
+    RegionClassifier(std::vector<Point>& outline, std::vector<Hole>& holes);
+
+    /* Checks if a point is inside the region and outside all its holes
+     * @param outline points of the region (the same used to build the classifier)
+     * @param holes holes of the region (the same used to build the classifier)
+     * @param p point to check
+     * @return whether the point is inside the region or not
+     */
+    bool contains(std::vector<Point>& outline, std::vector<Hole>& holes, Point p);
+};
+
+#endif
@@ -103,4 +103,6 @@ public:
     void setY(double newY);
 };
 
-#endif
\ No newline at end of file
+#include <delynoi/models/basic/PointIndex.h>
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef DELYNOI_POINTINDEX_H
+#define DELYNOI_POINTINDEX_H
+
+#include <delynoi/models/basic/Point.h>
+#include <utilities/UniqueIndex.h>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Index used by UniqueList<Point>. Points are equivalent when both coordinates differ by less than the comparison
+ * tolerance (as in Point::operator==), which is not a strict weak ordering, so instead of an ordered map the points are
+ * kept in a hash grid of cells four times the tolerance wide: all the points equivalent to a given one lie in its cell
+ * or, when it is closer than the tolerance to the border, in the neighbouring cells on that side (usually a single
+ * cell is visited, never more than four). When several registered points are equivalent to the one searched, the one
+ * with the lowest index is returned, so lookups give the same result as a linear search of the list. Operations are
+ * O(1) on average
+ */
+template <>
+class UniqueIndex<Point> {
+private:
+    /*
+     * Registered point: coordinates, associated index and next entry in the same cell (-1 at the end)
+     */
+    struct Entry {
+        double x;
+        double y;
+        int index;
+        int next;
+    };
+
+    /*
+     * Registered points, and first entry of each non empty cell
+     */
+    std::vector<Entry> entries;
+    std::unordered_map<unsigned long long, int> cells;
+
+    /*
+     * Tolerance used to build the grid, and width of the cells
+     */
+    double tolerance = -1;
+    double cellSize = 1;
+
+    /*
+     * Checks that the grid was built with the current tolerance, building it again otherwise
+     */
+    void checkTolerance();
+
+    /* Computes the coordinate of the cell that contains a value
+     * @param value coordinate of a point
+     * @param offset position of the value inside the cell (between 0 and 1)
+     * @return cell coordinate
+     */
+    long long cellCoordinate(double value, double& offset) const;
+
+    /* Computes the key of a cell
+     * @param i cell coordinate in the x axis
+     * @param j cell coordinate in the y axis
+     * @return key of the cell
+     */
+    unsigned long long cellKey(long long i, long long j) const;
+
+    /* Adds an entry to the chain of a cell
+     * @param key key of the cell
+     * @param entry index of the entry
+     */
+    void link(unsigned long long key, int entry);
+
+    /* Looks for the registered points equivalent to a given one
+     * @param x x coordinate of the point
+     * @param y y coordinate of the point
+     * @param key key of the cell that contains the point
+     * @return lowest index associated to an equivalent point, -1 if there is none
+     */
+    int lookup(double x, double y, unsigned long long& key) const;
+public:
+    /* Finds a point equivalent to the given one
+     * @param item point to look for
+     * @return index associated to the equivalent point (the lowest one if several are equivalent), -1 if there is none
+     */
+    int find(const Point& item);
+
+    /* Finds a point equivalent to the given one, registering the point with the given index if there is none
+     * @param item point to look for
+     * @param index index associated to the point if it is inserted
+     * @return index associated to the equivalent point, -1 if the point was inserted
+     */
+    int findOrInsert(const Point& item, int index);
+
+    /* Registers a point, even if an equivalent one was already registered
+     * @param item point to register
+     * @param index index associated to the point
+     */
+    void insert(const Point& item, int index);
+
+    /*
+     * Removes all registered points
+     */
+    void clear();
+};
+
+#endif
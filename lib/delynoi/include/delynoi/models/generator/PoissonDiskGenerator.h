@@ -0,0 +1,48 @@
+#ifndef DELYNOI_POISSONDISKGENERATOR_H
+#define DELYNOI_POISSONDISKGENERATOR_H
+
+#include <delynoi/models/generator/SizeFunction.h>
+#include <vector>
+
+class Region;
+
+/*
+ * Class that generates graded, well spaced seed points using Poisson-disk sampling with variable radius (Bridson's
+ * algorithm): new points are tried around the existing ones, at distances between one and two times the local size,
+ * and accepted when no point is closer than the size of either of them. Conflicts are found with two grids with cells
+ * of the minimum size: one with the cell of each point, and one where each point is registered in all the cells its
+ * exclusion disk touches, so each candidate only looks at the cells within its own radius.
+ */
+class PoissonDiskGenerator {
+private:
+    /*
+     * Size function that gives the spacing of the points
+     */
+    SizeFunction* size;
+
+    /*
+     * Number of candidates tried around each point before it is discarded
+     */
+    int attempts;
+
+    /*
+     * Seed of the random number generator (the same seed gives the same points)
+     */
+    unsigned int seed;
+public:
+    /*
+     * Constructor
+     * @param size size function (not owned by the generator)
+     * @param seed seed of the random number generator
+     * @param attempts number of candidates tried around each point
+     */
+    PoissonDiskGenerator(SizeFunction* size, unsigned int seed = 0, int attempts = 30);
+
+    /* Generates points inside a region (and outside its holes)
+     * @param points vector where the generated points are added
+     * @param region region to fill
+     */
+    void generate(std::vector<Point>& points, Region& region);
+};
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef DELYNOI_SIZEFUNCTION_H
+#define DELYNOI_SIZEFUNCTION_H
+
+#include <delynoi/models/basic/Point.h>
+
+/*
+ * Abstract class that models a spatial size function: the desired distance between seed points around each point of
+ * the domain.
+ */
+class SizeFunction {
+public:
+    /*
+     * Evaluates the size function
+     * @param p point of the domain
+     * @return desired spacing around p (strictly positive)
+     */
+    virtual double apply(Point p) = 0;
+
+    /*
+     * @return a lower bound of the size function in the domain (used to build the acceleration grids)
+     */
+    virtual double getMinimumSize() = 0;
+};
+
+#endif
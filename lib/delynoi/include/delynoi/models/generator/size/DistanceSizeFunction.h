@@ -0,0 +1,89 @@
+#ifndef DELYNOI_DISTANCESIZEFUNCTION_H
+#define DELYNOI_DISTANCESIZEFUNCTION_H
+
+#include <delynoi/models/generator/SizeFunction.h>
+#include <delynoi/models/basic/PointSegment.h>
+#include <delynoi/models/hole/Hole.h>
+#include <vector>
+
+/*
+ * Size function graded with the distance to a set of features (holes, constrained segments or points): the size is
+ * minSize on the features, grows linearly with the distance to them, and is limited to maxSize. The features are
+ * bucketed in a uniform grid, built on the first evaluation after they change, and each evaluation only visits the
+ * cells around the point that are closer than the nearest feature found so far (and than the distance at which the
+ * size reaches maxSize)
+ */
+class DistanceSizeFunction : public SizeFunction {
+private:
+    /*
+     * Size on the features, maximum size and growth of the size per unit of distance
+     */
+    double minSize;
+    double maxSize;
+    double gradient;
+
+    /*
+     * Features, as segments (isolated points are stored as zero length segments)
+     */
+    std::vector<PointSegment> features;
+
+    /*
+     * Grid over the bounding box of the features (about one feature per cell): origin, opposite corner, cell size,
+     * number of cells in each axis, and features touching each cell in compressed form
+     */
+    double xMin;
+    double yMin;
+    double xMax;
+    double yMax;
+    double cellSize;
+    int nX;
+    int nY;
+    std::vector<int> cellOffsets;
+    std::vector<int> cellFeatures;
+
+    /*
+     * Whether the grid contains the current features
+     */
+    bool gridBuilt;
+
+    /*
+     * Buckets the features in the grid
+     */
+    void buildGrid();
+public:
+    /*
+     * Constructor
+     * @param minSize size on the features
+     * @param maxSize maximum size
+     * @param gradient growth of the size per unit of distance to the features
+     */
+    DistanceSizeFunction(double minSize, double maxSize, double gradient);
+
+    /* Adds the boundary of a hole to the features
+     * @param hole hole to add
+     */
+    void addHole(Hole& hole);
+
+    /* Adds a segment to the features
+     * @param segment segment to add
+     */
+    void addSegment(PointSegment segment);
+
+    /* Adds a point to the features
+     * @param p point to add
+     */
+    void addPoint(Point p);
+
+    /*
+     * @param p point of the domain
+     * @return size at p (maxSize if there are no features)
+     */
+    double apply(Point p);
+
+    /*
+     * @return size on the features
+     */
+    double getMinimumSize();
+};
+
+#endif
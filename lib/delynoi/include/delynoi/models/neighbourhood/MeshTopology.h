@@ -0,0 +1,178 @@
+#ifndef DELYNOI_MESHTOPOLOGY_H
+#define DELYNOI_MESHTOPOLOGY_H
+
+#include <delynoi/models/basic/IndexSegment.h>
+#include <utility>
+#include <vector>
+
+/*
+ * Contiguous range of indexes stored in a MeshTopology (valid while the topology exists)
+ */
+struct IndexRange {
+    const int* first;
+    const int* last;
+
+    const int* begin() const { return first; }
+    const int* end() const { return last; }
+    int size() const { return (int) (last - first); }
+    int operator[](int i) const { return first[i]; }
+};
+
+/*
+ * Class that represents the neighbourhood information of a mesh using indexes only (half-edge structure plus compressed
+ * vertex to cell lists), built by sorting instead of inserting in hash or tree maps. Each cell with k vertices owns k
+ * consecutive half-edges, the j-th going from its j-th vertex to the next one; twin half-edges (the same edge seen from
+ * the neighbouring cell) are linked, and each undirected edge has a single index. Edges are numbered in increasing order
+ * of their endpoints, and the cells around each vertex are listed in increasing order, so the structure does not depend
+ * on how the mesh was created. All queries are O(1) (or O(number of results) for ranges)
+ */
+class MeshTopology {
+private:
+    /*
+     * Number of vertices of the mesh (including points not used by any cell)
+     */
+    int numberOfVertices;
+
+    /*
+     * Cells in compressed form: the half-edges of cell c are [cellOffsets[c], cellOffsets[c+1]), and halfEdgeOrigin
+     * holds the vertex each half-edge starts from (the cell vertices, in order)
+     */
+    std::vector<int> cellOffsets;
+    std::vector<int> halfEdgeOrigin;
+
+    /*
+     * For each half-edge: cell that owns it, opposite half-edge (-1 on the boundary) and undirected edge index
+     */
+    std::vector<int> halfEdgeCell;
+    std::vector<int> halfEdgeTwin;
+    std::vector<int> halfEdgeEdge;
+
+    /*
+     * For each edge, the half-edge of the cell with the lowest index that contains it
+     */
+    std::vector<int> edgeHalfEdge;
+
+    /*
+     * Indexes of the edges with a single incident cell
+     */
+    std::vector<int> boundaryEdges;
+
+    /*
+     * Vertex star in compressed form: for vertex v, [vertexOffsets[v], vertexOffsets[v+1]) indexes the half-edges
+     * that start from v and their cells (in increasing cell order)
+     */
+    std::vector<int> vertexOffsets;
+    std::vector<int> vertexHalfEdges;
+    std::vector<int> vertexCells;
+public:
+    /*
+     * Default constructor. Creates an empty topology
+     */
+    MeshTopology();
+
+    /*
+     * Constructor. Builds the topology from the cells of a mesh in compressed form
+     * @param numberOfVertices number of points of the mesh
+     * @param cellOffsets offsets of the first vertex of each cell (with one extra entry at the end)
+     * @param cellVertices vertex indexes of all cells, one after the other
+     */
+    MeshTopology(int numberOfVertices, const std::vector<int>& cellOffsets, const std::vector<int>& cellVertices);
+
+    /*
+     * @return number of vertices, cells, edges and half-edges
+     */
+    int getNumberOfVertices() const { return numberOfVertices; }
+    int getNumberOfCells() const { return (int) cellOffsets.size() - 1; }
+    int getNumberOfEdges() const { return (int) edgeHalfEdge.size(); }
+    int getNumberOfHalfEdges() const { return (int) halfEdgeOrigin.size(); }
+
+    /*
+     * Half-edge queries
+     * @param h half-edge index
+     */
+    int origin(int h) const { return halfEdgeOrigin[h]; }
+    int target(int h) const { return halfEdgeOrigin[next(h)]; }
+    int cell(int h) const { return halfEdgeCell[h]; }
+    int twin(int h) const { return halfEdgeTwin[h]; }
+    int edge(int h) const { return halfEdgeEdge[h]; }
+    int next(int h) const {
+        int c = halfEdgeCell[h];
+        return h + 1 < cellOffsets[c + 1]? h + 1 : cellOffsets[c];
+    }
+    int previous(int h) const {
+        int c = halfEdgeCell[h];
+        return h > cellOffsets[c]? h - 1 : cellOffsets[c + 1] - 1;
+    }
+
+    /*
+     * Cell queries
+     * @param c cell index
+     */
+    int firstHalfEdge(int c) const { return cellOffsets[c]; }
+    int cellSize(int c) const { return cellOffsets[c + 1] - cellOffsets[c]; }
+    IndexRange cellVertices(int c) const {
+        return IndexRange{halfEdgeOrigin.data() + cellOffsets[c], halfEdgeOrigin.data() + cellOffsets[c + 1]};
+    }
+
+    /* Gets the cell on the other side of an edge of a cell
+     * @param c cell index
+     * @param j local index of the edge (from the j-th vertex of the cell to the next one)
+     * @return index of the neighbouring cell, -1 if the edge is on the boundary
+     */
+    int neighbour(int c, int j) const {
+        int t = halfEdgeTwin[cellOffsets[c] + j];
+        return t<0? -1 : halfEdgeCell[t];
+    }
+
+    /*
+     * Edge queries
+     * @param e edge index
+     */
+    IndexSegment getEdge(int e) const {
+        int h = edgeHalfEdge[e];
+        return IndexSegment(origin(h), target(h));
+    }
+    int edgeHalfEdgeOf(int e) const { return edgeHalfEdge[e]; }
+    bool isBoundaryEdge(int e) const { return halfEdgeTwin[edgeHalfEdge[e]] < 0; }
+
+    /* Gets the cells incident to an edge
+     * @param e edge index
+     * @return the cell with the lowest index first, and the other one (-1 on the boundary) second
+     */
+    std::pair<int,int> edgeCells(int e) const {
+        int h = edgeHalfEdge[e];
+        int t = halfEdgeTwin[h];
+        return std::make_pair(halfEdgeCell[h], t<0? -1 : halfEdgeCell[t]);
+    }
+
+    /*
+     * @return indexes of all boundary edges, in increasing order
+     */
+    const std::vector<int>& getBoundaryEdges() const { return boundaryEdges; }
+
+    /*
+     * Vertex star queries
+     * @param v vertex index
+     * @return cells that contain v (in increasing order), or the half-edges that start from v (in the same order)
+     */
+    IndexRange vertexStar(int v) const {
+        return IndexRange{vertexCells.data() + vertexOffsets[v], vertexCells.data() + vertexOffsets[v + 1]};
+    }
+    IndexRange outgoingHalfEdges(int v) const {
+        return IndexRange{vertexHalfEdges.data() + vertexOffsets[v], vertexHalfEdges.data() + vertexOffsets[v + 1]};
+    }
+
+    /* Finds the edge between two vertices, looking in the stars of both
+     * @param a first endpoint
+     * @param b second endpoint
+     * @return edge index, -1 if the vertices are not connected
+     */
+    int findEdge(int a, int b) const;
+
+    /*
+     * @return memory used by the structure, in bytes
+     */
+    size_t memoryUsage() const;
+};
+
+#endif
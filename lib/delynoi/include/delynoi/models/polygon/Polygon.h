@@ -56,10 +56,18 @@ protected:
 
 public:
     /*
-     * Constructor. Receives a list of point indexes and the mesh points to create the polygon
+     * Constructor. Receives a list of point indexes and the mesh points to create the polygon, and checks that it does
+     * not self-intersect
      */
     Polygon(std::vector<int> &points, std::vector<Point> &p);
 
+    /*
+     * Constructor. Receives a list of point indexes and the mesh points to create the polygon
+     * @param validate whether to check that the polygon does not self-intersect; generators whose output is known to
+     * be simple (triangulations, Voronoi cells) skip it, so the construction only copies the indexes
+     */
+    Polygon(std::vector<int> &points, std::vector<Point> &p, bool validate);
+
     /*
      * Constructor. Receives a list of points representing the polygon
      */
@@ -70,6 +78,11 @@ public:
      */
     Polygon(const Polygon &obj);
 
+    /*
+     * Copy assignment.
+     */
+    Polygon& operator=(const Polygon &obj) = default;
+
     /*
      * Default constructor.
      */
@@ -141,6 +154,12 @@ public:
      */
     void mutate(std::vector<Point> &p);
 
+    /* Changes the indexes of the points of the polygon after the points of the mesh are reordered, keeping the
+     * geometric information already computed (which does not change)
+     * @param newIndexes new index of each point of the mesh
+     */
+    void renumberPoints(const std::vector<int> &newIndexes);
+
     /* Determines if a point is inside the polygon
      * @param p mesh points
      * @param point point to check
@@ -185,7 +204,8 @@ public:
      */
     bool isVertex(int index);
 
-    /* Checks if the polygon self-intersects
+    /* Checks if the polygon self-intersects, with a sweep line over its sides (Shamos-Hoey): only sides that are
+     * neighbours in the sweep line are tested, in O(n log n)
      * @param points mesh points
      * @return if the polygon is self-intersecting
      */
@@ -0,0 +1,57 @@
+#ifndef DELYNOI_CELLAGGLOMERATOR_H
+#define DELYNOI_CELLAGGLOMERATOR_H
+
+#include <delynoi/models/Mesh.h>
+
+/*
+ * Mesh coarsening operator that merges adjacent cells into larger polygons (virtual element methods accept any simple
+ * polygon, so the coarse cells do not need to be convex). Cells are merged in pairs, always taking the aggregate with
+ * the smallest area and joining it with the neighbour (found through the SegmentMap of the mesh) with which it shares
+ * the longest boundary, which keeps the aggregates compact. Two aggregates are only merged when their union is a
+ * simple polygon, that is, when they share a single chain of edges and no other vertex. Vertices on the boundary of
+ * the aggregates are kept, so the coarse mesh stays conforming; the vertices left inside an aggregate are removed
+ */
+class CellAgglomerator {
+private:
+    /*
+     * Index of the coarse cell that contains each cell of the last mesh agglomerated
+     */
+    std::vector<int> parents;
+
+    /* Merges the cells of a mesh
+     * @param mesh mesh to coarsen
+     * @param marked cells that can be merged
+     * @param maxCells maximum number of cells of an aggregate
+     * @param targetCells the merging stops when the mesh has this number of cells
+     * @return coarse mesh
+     */
+    Mesh<Polygon> merge(Mesh<Polygon>& mesh, std::vector<bool>& marked, int maxCells, int targetCells);
+public:
+    /*
+     * Default constructor
+     */
+    CellAgglomerator();
+
+    /* Merges the cells of a mesh until it has the given number of cells (or no more cells can be merged)
+     * @param mesh mesh to coarsen (it is not modified)
+     * @param targetCells number of cells of the coarse mesh
+     * @return coarse mesh, with its own segment and point maps
+     */
+    Mesh<Polygon> agglomerate(Mesh<Polygon>& mesh, int targetCells);
+
+    /* Merges the marked cells of a mesh (cells are only merged with marked neighbours), creating aggregates of at most
+     * the given number of cells
+     * @param mesh mesh to coarsen (it is not modified)
+     * @param marked indicator of the cells to coarsen (one value per cell)
+     * @param cellsPerAggregate maximum number of cells of an aggregate
+     * @return coarse mesh, with its own segment and point maps
+     */
+    Mesh<Polygon> agglomerate(Mesh<Polygon>& mesh, std::vector<bool>& marked, int cellsPerAggregate);
+
+    /*
+     * @return index of the coarse cell that contains each cell of the last mesh agglomerated
+     */
+    std::vector<int>& getParents();
+};
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef DELYNOI_SHORTEDGECOLLAPSER_H
+#define DELYNOI_SHORTEDGECOLLAPSER_H
+
+#include <delynoi/models/Mesh.h>
+
+/*
+ * Mesh optimization pass that collapses the edges that are much shorter than the cells around them (Voronoi diagrams
+ * usually contain many of them, and each one adds a node to the problem while contributing little to the accuracy).
+ * An edge is collapsed when its length is smaller than a ratio of the diameter of its smallest incident cell: its
+ * endpoints are merged into their middle point, or into one of them if the other is a boundary or constrained vertex
+ * (those never move, so edges joining two of them are kept). A collapse is rejected when it would leave a cell with
+ * less than three vertices, make a convex cell non convex or a cell non star-shaped with respect to its centroid, or
+ * join two vertices with a common neighbour (which would duplicate an edge). Edges are processed from the shortest
+ * one, each cell taking part in a single collapse per pass, until a pass collapses no edge
+ */
+class ShortEdgeCollapser {
+private:
+    /*
+     * Edges shorter than ratio times the diameter of their smallest incident cell are collapsed
+     */
+    double ratio;
+
+    /*
+     * Number of points of the last mesh processed, before and after collapsing its edges
+     */
+    int originalPoints = 0;
+    int remainingPoints = 0;
+public:
+    /*
+     * Constructor
+     * @param ratio relative threshold (between 0 and 1) of the length of the collapsed edges
+     */
+    explicit ShortEdgeCollapser(double ratio);
+
+    /* Collapses the short edges of a mesh
+     * @param mesh mesh to process (it is not modified)
+     * @param constrainedPoints indexes of the points that must not move, besides the ones on the boundary
+     * @return new mesh, with its own segment and point maps; points keep their relative order
+     */
+    Mesh<Polygon> collapse(Mesh<Polygon>& mesh, const std::vector<int>& constrainedPoints = std::vector<int>());
+
+    /*
+     * @return number of points removed from the last mesh (one per collapsed edge)
+     */
+    int getRemovedPoints();
+
+    /* Computes the reduction of degrees of freedom obtained in the last mesh
+     * @param degreesOfFreedomPerPoint degrees of freedom of each node (2 for elasticity)
+     * @return number of degrees of freedom removed
+     */
+    int getDOFReduction(int degreesOfFreedomPerPoint);
+
+    /* Computes the relative reduction of degrees of freedom obtained in the last mesh (the same for any number of
+     * degrees of freedom per point)
+     * @return removed points over the original number of points
+     */
+    double getRelativeDOFReduction();
+};
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef DELYNOI_EARCLIPPER_H
+#define DELYNOI_EARCLIPPER_H
+
+#include <delynoi/models/basic/Point.h>
+#include <utilities/Trio.h>
+#include <vector>
+
+/*
+ * Class that triangulates simple polygons (convex or not, in either orientation) by ear clipping. The remaining
+ * vertices are kept in a circular doubly linked list, and each vertex keeps whether it is reflex and whether it is an
+ * ear. Clipping an ear only changes its two neighbours, and only reflex vertices can be inside an ear, so they are kept
+ * in a grid and each ear test only looks at the cells around the corner (O(n) for convex polygons, O(n^2) in the worst
+ * case). The result is a list of index triples, so neither the polygon nor the points are modified
+ */
+class EarClipper {
+private:
+    /*
+     * Circular doubly linked list of the remaining vertices (positions in the polygon)
+     */
+    std::vector<int> previous;
+    std::vector<int> next;
+
+    /*
+     * State of each vertex: clipped, reflex (or collinear with its neighbours) and ear
+     */
+    std::vector<bool> removed;
+    std::vector<bool> reflex;
+    std::vector<bool> ear;
+
+    /*
+     * Grid with the reflex vertices: origin, cell size, number of cells in each axis and vertices in each cell
+     */
+    double xMin;
+    double yMin;
+    double cellSize;
+    int nX;
+    int nY;
+    std::vector<std::vector<int>> cells;
+
+    /*
+     * Number of remaining reflex vertices (when there are none, every convex corner is an ear)
+     */
+    int reflexVertices;
+
+    /*
+     * Orientation of the polygon (1 if counter clockwise, -1 if clockwise)
+     */
+    double sign;
+
+    /*
+     * Cell coordinates of a value (clamped to the grid)
+     */
+    int cellX(double x);
+    int cellY(double y);
+
+    /* Orientation of a corner, positive if it is convex
+     * @param polygon point indexes of the polygon
+     * @param points points the indexes refer to
+     * @param i position of the corner
+     * @return orientation of the corner
+     */
+    double corner(const std::vector<int>& polygon, const std::vector<Point>& points, int i);
+
+    /* Updates the state (reflex and ear) of a vertex
+     * @param polygon point indexes of the polygon
+     * @param points points the indexes refer to
+     * @param i position of the vertex
+     */
+    void classify(const std::vector<int>& polygon, const std::vector<Point>& points, int i);
+public:
+    /* Triangulates a polygon
+     * @param polygon point indexes of the polygon
+     * @param points points the indexes refer to (most likely, mesh points)
+     * @return triangles as triples of point indexes, oriented as the polygon (triangles with no area are skipped)
+     */
+    std::vector<Trio<int>> triangulate(const std::vector<int>& polygon, const std::vector<Point>& points);
+};
+
+#endif
@@ -4,16 +4,9 @@
 #include "TriangulationGenerator.h"
 
 /*
- * Class that triangulates a polygon using the classic ear triangulation scheme
+ * Class that triangulates a polygon using the classic ear triangulation scheme (see EarClipper)
  */
 class EarTriangulationGenerator : public TriangulationGenerator {
-private:
-    /* Gets an independant ear out of the polygon
-     * @param point mesh points
-     * @param pointList list of points of the polygon
-     * @return a triangle (an ear of the polygon)
-     */
-    Triangle getEar(std::vector<Point>& points,  std::vector<int>& pointList);
 public:
     /* Triangulates a polygon.
     * @param p polygon to triangulate
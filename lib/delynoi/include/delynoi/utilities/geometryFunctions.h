@@ -45,6 +45,25 @@ namespace geometry_functions{
      * @return area of the polygon
      */
     extern double area(std::vector<Point>& points);
+
+    /* Computes the circumcenter of a triangle
+     * @param A B C vertices of the triangle
+     * @return circumcenter of the triangle
+     */
+    extern Point circumcenter(Point A, Point B, Point C);
+
+    /* Lists the cells of a uniform grid touched by a segment enlarged by a margin (the cells with a point closer than
+     * the margin to the segment in both axes), walking the columns that the segment crosses, so the work is
+     * proportional to the length of the segment and not to the area of its bounding box
+     * @param a b endpoints of the segment
+     * @param margin enlargement of the segment in each axis
+     * @param xMin yMin origin of the grid
+     * @param cellSize size of the cells
+     * @param nX nY number of cells in each axis (parts of the segment outside the grid are ignored)
+     * @param cells vector where the indexes (j*nX + i) of the touched cells are appended
+     */
+    extern void segmentCells(Point a, Point b, double margin, double xMin, double yMin, double cellSize, int nX,
+                             int nY, std::vector<int>& cells);
 }
 
 #endif
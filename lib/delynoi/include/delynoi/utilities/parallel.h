@@ -0,0 +1,67 @@
+#ifndef DELYNOI_PARALLEL_H
+#define DELYNOI_PARALLEL_H
+
+#include <delynoi/config/DelynoiConfig.h>
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+/*
+ * Helpers to run loops of the Delynoi library in several threads
+ */
+namespace delynoi_utilities {
+    /*
+     * @return number of threads set in DelynoiConfig (zero meaning the number of hardware threads)
+     */
+    inline int numberOfThreads(){
+        int threads = DelynoiConfig::instance()->getNumberOfThreads();
+        return threads>0? threads : std::max(1, (int) std::thread::hardware_concurrency());
+    }
+
+    /* Runs f(begin, end) over contiguous blocks of [0, n), one per thread, with the Delynoi configuration of the
+     * calling thread activated in all of them. If any block throws, all threads are joined and the exception of the
+     * first block that threw is rethrown in the calling thread
+     * @param n number of iterations
+     * @param threads number of threads
+     * @param f function called with each block
+     */
+    template <typename F>
+    void parallelFor(int n, int threads, F f){
+        DelynoiConfig* config = DelynoiConfig::instance();
+        int blockSize = (n + threads - 1)/threads;
+        int blocks = blockSize>0? (n + blockSize - 1)/blockSize : 0;
+
+        std::vector<std::exception_ptr> errors(std::max(1, blocks));
+        std::vector<std::thread> pool;
+        for (int t = 1; t < blocks; ++t) {
+            std::exception_ptr* error = &errors[t];
+            pool.push_back(std::thread([=]() {
+                try{
+                    DelynoiConfig::activate(config);
+                    f(t*blockSize, std::min(n, (t+1)*blockSize));
+                }catch(...){
+                    *error = std::current_exception();
+                }
+            }));
+        }
+
+        try{
+            f(0, std::min(n, blockSize));
+        }catch(...){
+            errors[0] = std::current_exception();
+        }
+
+        for(std::thread& thread: pool){
+            thread.join();
+        }
+
+        for(std::exception_ptr& error: errors){
+            if(error){
+                std::rethrow_exception(error);
+            }
+        }
+    }
+}
+
+#endif
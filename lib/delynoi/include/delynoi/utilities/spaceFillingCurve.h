@@ -0,0 +1,39 @@
+#ifndef DELYNOI_SPACEFILLINGCURVE_H
+#define DELYNOI_SPACEFILLINGCURVE_H
+
+#include <delynoi/models/basic/Point.h>
+#include <delynoi/config/DelynoiConfig.h>
+#include <cstdint>
+#include <vector>
+
+/*
+ * Space filling curves, used to sort points so that nearby points get nearby indexes
+ */
+namespace delynoi_utilities {
+    /*
+     * Number of bits of each coordinate in the keys of the curves
+     */
+    const int curveBits = 16;
+
+    /* Computes the position of a cell in the Hilbert curve that covers a 2^curveBits x 2^curveBits grid
+     * @param x,y cell coordinates (lower than 2^curveBits)
+     * @return position of the cell in the curve
+     */
+    uint64_t hilbertKey(uint32_t x, uint32_t y);
+
+    /* Computes the position of a cell in the Morton (Z order) curve, interleaving the bits of its coordinates
+     * @param x,y cell coordinates (lower than 2^curveBits)
+     * @return position of the cell in the curve
+     */
+    uint64_t mortonKey(uint32_t x, uint32_t y);
+
+    /* Sorts a set of points along a space filling curve laid over their bounding box. Points in the same cell of the
+     * curve keep their relative order, so the result is deterministic
+     * @param points points to sort
+     * @param ordering curve to follow (Original keeps the order of the points)
+     * @return index of the point at each position of the new order
+     */
+    std::vector<int> curveOrder(const std::vector<Point>& points, MeshOrdering ordering);
+}
+
+#endif
@@ -24,9 +24,22 @@ private:
      * @return circumcenter
      */
     int getCircumcenter(DelaunayInfo& del, int triangle, int edge);
+
+    /* Computes the Voronoi diagram walking the Delaunay star of each point, one after the other
+     * @param del delaunay triangulation
+     */
+    void convertSerial(DelaunayInfo& del);
+
+    /* Computes the Voronoi diagram in parallel: the Delaunay stars are walked concurrently, the new points (middle
+     * points of boundary edges and boundary seeds) are numbered in the same order as the serial algorithm, and the
+     * cells and neighbourhood maps are then built concurrently. The result is the same as convertSerial's
+     * @param del delaunay triangulation
+     * @param threads number of threads
+     */
+    void convertParallel(DelaunayInfo& del, int threads);
 public:
     /*
-     * Constructor
+     * Constructor. Uses the number of threads set in DelynoiConfig
      */
     explicit DelaunayToVoronoi(DelaunayInfo& del);
     /*
@@ -0,0 +1,241 @@
+#ifndef DELYNOI_INCREMENTALVORONOIGENERATOR_H
+#define DELYNOI_INCREMENTALVORONOIGENERATOR_H
+
+#include <delynoi/models/Region.h>
+#include <delynoi/models/Mesh.h>
+#include <delynoi/voronoi/structures/VoronoiUpdate.h>
+
+/*
+ * Class that keeps the conforming Delaunay triangulation of a domain alive, so that seeds can be inserted or removed
+ * without computing the Voronoi diagram again. Insertions split the triangle (or edge) containing the new point and
+ * restore the Delaunay property with local edge flips; removals retriangulate the star of the point. Boundary edges
+ * are never flipped, and are split at their middle point when a vertex falls inside their diametral circle (as
+ * Triangle does to build the conforming triangulation). Only the Voronoi cells of the points whose Delaunay star
+ * changed are computed again.
+ * Every point of the triangulation (seeds, region vertices and points added on the boundary) owns a cell, identified
+ * by the index of the point; ids never change, and the ids of removed cells are not reused
+ */
+class IncrementalVoronoiGenerator {
+private:
+    /*
+     * Points of the triangulation, and one triangle that contains each of them (-1 for removed points)
+     */
+    std::vector<Point> points;
+    std::vector<int> pointTriangle;
+
+    /*
+     * Triangles (three counterclockwise vertices each, the first one -1 for free slots) and the neighbour opposite to
+     * each vertex (-1 on the boundary of the domain)
+     */
+    std::vector<int> triangles;
+    std::vector<int> neighbours;
+    std::vector<int> freeTriangles;
+
+    /*
+     * Index (in voronoiPoints) of the circumcenter of each triangle, -1 if not computed yet
+     */
+    std::vector<int> triangleCircumcenters;
+
+    /*
+     * Triangle where the last point location finished (point locations start from it)
+     */
+    int lastTriangle = -1;
+
+    /*
+     * Vertices of the Voronoi cells (points that are no longer used are kept until the mesh is created) and vertex
+     * indexes of the cell of each point, counterclockwise
+     */
+    UniqueList<Point> voronoiPoints;
+    std::vector<std::vector<int>> cells;
+
+    /*
+     * Triangles created or modified by the current update
+     */
+    std::vector<int> modifiedTriangles;
+
+    /*
+     * Marks of the points already collected as vertices of the modified triangles (all false between updates)
+     */
+    std::vector<char> changedPoints;
+
+    /* Creates a triangle, reusing a free slot if possible
+     * @param a b c vertices of the triangle (counterclockwise)
+     * @return index of the triangle
+     */
+    int newTriangle(int a, int b, int c);
+
+    /* Changes the vertices of a triangle
+     * @param t index of the triangle
+     * @param a b c vertices of the triangle (counterclockwise)
+     */
+    void setTriangle(int t, int a, int b, int c);
+
+    /* Sets the neighbour opposite to a vertex of a triangle, and the triangle as neighbour of the other one
+     * @param t index of the triangle
+     * @param k local index of the vertex
+     * @param n index of the neighbour (-1 on the boundary)
+     */
+    void link(int t, int k, int n);
+
+    /* Adds a point to the triangulation
+     * @param p point to add
+     * @return index of the point
+     */
+    int addPoint(const Point& p);
+
+    /* Finds the triangle that contains a point, walking from a triangle close to it
+     * @param p point to locate
+     * @param edge local index of the vertex opposite to the edge that contains the point (-1 if it is inside)
+     * @param vertex index of the point of the triangulation equal to p (-1 if there is none)
+     * @param hint triangle where the walk starts (-1 to start from where the last location finished)
+     * @return index of the triangle, -1 if the point is outside the domain
+     */
+    int locate(const Point& p, int& edge, int& vertex, int hint = -1);
+
+    /* Inserts a point inside a triangle, splitting it in three
+     * @param t index of the triangle
+     * @param v index of the point to insert (not in the triangulation)
+     * @return index of the point
+     */
+    int insertInTriangle(int t, int v);
+
+    /* Inserts a point on an edge, splitting the triangles on both sides in two
+     * @param t index of a triangle that contains the edge
+     * @param k local index of the vertex opposite to the edge
+     * @param v index of the point to insert (not in the triangulation)
+     * @return index of the point
+     */
+    int insertInEdge(int t, int k, int v);
+
+    /* Flips the edges that are not locally Delaunay
+     * @param pending triangles whose edge opposite to their first vertex must be checked
+     */
+    void legalize(std::vector<int>& pending);
+
+    /* Flips the edge opposite to the first vertex of a triangle; the first vertex is kept first in both new triangles
+     * @param t index of the triangle
+     */
+    void flip(int t);
+
+    /* Flips edges until the triangulation is Delaunay again, checking all the edges of the given triangles and of the
+     * ones created by the flips (for triangulations whose vertices moved)
+     * @param pending triangles to check
+     */
+    void restoreDelaunay(std::vector<int>& pending);
+
+    /* Moves a point without changing the triangulation around it, which is only possible if the new position is inside
+     * the polygon formed by its neighbours (and sees all its edges); the Delaunay property is then restored with flips
+     * @param v index of the point
+     * @param p new position
+     * @return whether the point was moved
+     */
+    bool relocate(int v, const Point& p);
+
+    /* Splits the boundary edges of the modified triangles whose diametral circle contains the opposite vertex
+     * @param update update where the new points are reported
+     */
+    void splitEncroachedEdges(VoronoiUpdate& update);
+
+    /* Inserts a seed, without computing the cells again
+     * @param seed point to insert
+     * @param update update where the new point is reported
+     * @param id index to give to the point (a removed one), -1 to create a new one
+     * @return whether the seed was inserted (false if it is equal to an existing point)
+     */
+    bool insertPoint(Point seed, VoronoiUpdate& update, int id = -1);
+
+    /* Removes a seed, without computing the cells again
+     * @param cell id of the cell of the seed
+     */
+    void removePoint(int cell);
+
+    /* Computes again the cells of the points of the modified triangles, and fills the changed cells of the update
+     * @param update update to complete
+     */
+    void finishUpdate(VoronoiUpdate& update);
+
+    /* Computes the Voronoi cell of a point
+     * @param v index of the point
+     */
+    void computeCell(int v);
+
+    /* Gets the circumcenter of a triangle
+     * @param t index of the triangle
+     * @return index of the circumcenter in voronoiPoints
+     */
+    int circumcenter(int t);
+
+    /* Gets the local index of a vertex in a triangle
+     * @param t index of the triangle
+     * @param v index of the point
+     * @return local index of the vertex
+     */
+    int corner(int t, int v);
+public:
+    /*
+     * Constructor. Computes the conforming Delaunay triangulation of the seeds in the domain, and all the cells
+     */
+    IncrementalVoronoiGenerator(std::vector<Point>& seeds, Region region);
+
+    /* Inserts a seed. Inserting a point equal to an existing one does nothing
+     * @param p point to insert (must be inside the domain)
+     * @return cells affected by the insertion
+     */
+    VoronoiUpdate insert(Point p);
+
+    /* Inserts several seeds
+     * @param seeds points to insert (must be inside the domain)
+     * @return cells affected by the insertions
+     */
+    VoronoiUpdate insert(std::vector<Point>& seeds);
+
+    /* Removes a seed (points on the boundary of the domain can not be removed)
+     * @param cell id of the cell of the seed
+     * @return cells affected by the removal
+     */
+    VoronoiUpdate remove(int cell);
+
+    /* Moves seeds to new positions, keeping their cell ids. A seed that stays inside the polygon formed by its
+     * neighbours is moved in place and the Delaunay property is restored with edge flips; any other seed is removed and
+     * inserted again, starting the search of its new position from the place it left (a seed moved onto an existing
+     * point disappears, and is reported as removed). Either way the cost of a move depends on the distance, not on the
+     * size of the mesh. The whole batch is checked before any seed is moved, so an invalid id or position leaves the
+     * diagram unchanged
+     * @param ids ids of the cells of the seeds (distinct, not on the boundary)
+     * @param positions new positions of the seeds (inside the domain)
+     * @param skipOutside whether seeds whose new position is outside the domain are left in place instead of rejecting
+     * the batch
+     * @return cells affected by the displacements
+     */
+    VoronoiUpdate move(std::vector<int>& ids, std::vector<Point>& positions, bool skipOutside = false);
+
+    /* Checks if a point is inside the triangulated domain (so that it can be inserted)
+     * @param p point to check
+     * @return whether the point is inside the domain or not
+     */
+    bool contains(const Point& p);
+
+    /*
+     * @param cell cell id
+     * @return the seed (point of the triangulation) of the cell
+     */
+    Point getSeed(int cell);
+
+    /*
+     * @param cell cell id
+     * @return vertices of the cell, counterclockwise
+     */
+    std::vector<Point> getCellPoints(int cell);
+
+    /*
+     * @return ids of the existing cells, in increasing order (the order of the polygons of getMesh)
+     */
+    std::vector<int> getCellIds();
+
+    /*
+     * @return Voronoi diagram in Mesh form (polygon i is the cell getCellIds()[i])
+     */
+    Mesh<Polygon> getMesh();
+};
+
+#endif
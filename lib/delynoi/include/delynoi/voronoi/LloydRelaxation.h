@@ -0,0 +1,50 @@
+#ifndef DELYNOI_LLOYDRELAXATION_H
+#define DELYNOI_LLOYDRELAXATION_H
+
+#include <delynoi/voronoi/IncrementalVoronoiGenerator.h>
+
+/*
+ * Class that computes centroidal Voronoi tessellations using Lloyd's algorithm: in each iteration every seed is moved
+ * to the centroid of its cell, until the seeds stop moving or the maximum number of iterations is reached. The
+ * triangulation is kept between iterations (seeds are moved using an IncrementalVoronoiGenerator), so only the cells
+ * around the seeds that moved are computed again. Seeds on the boundary of the domain are never moved
+ */
+class LloydRelaxation {
+private:
+    /*
+     * Maximum number of iterations, and displacement under which a seed is considered fixed
+     */
+    int maxIterations;
+    double tolerance;
+
+    /*
+     * Number of iterations and maximum displacement of a seed in the last iteration of the last relaxation
+     */
+    int iterations = 0;
+    double displacement = 0;
+public:
+    /*
+     * Constructor
+     * @param maxIterations maximum number of iterations
+     * @param tolerance the relaxation stops when no seed moves more than this distance
+     */
+    LloydRelaxation(int maxIterations, double tolerance);
+
+    /* Relaxes the seeds of a region, replacing them by the relaxed ones
+     * @param region region whose seed points are relaxed
+     * @return centroidal Voronoi diagram of the region
+     */
+    Mesh<Polygon> relax(Region& region);
+
+    /*
+     * @return number of iterations done by the last relaxation
+     */
+    int getIterations();
+
+    /*
+     * @return maximum displacement of a seed in the last iteration of the last relaxation
+     */
+    double getDisplacement();
+};
+
+#endif
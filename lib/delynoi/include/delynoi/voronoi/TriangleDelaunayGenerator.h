@@ -8,10 +8,6 @@
 #include <delynoi/utilities/delynoi_utilities.h>
 #include <chrono>
 
-extern "C"{
-#include <delynoi/voronoi/lib/triangle.h>
-};
-
 /*
  * Class in charge of computing the Delaunay triangulation using the seed points and domain given, using Triangle
  */
@@ -24,11 +20,10 @@ private:
     std::vector<Point> seedPoints;
 
     /*
-     * Output for the representation of the Delaunay triangulation as a Delynoi mesh
+     * Output of Triangle (used in place) and points of the Delaunay triangulation
      */
-    std::vector<Triangle> triangles;
+    std::shared_ptr<TriangulationData> triangulation;
     std::vector<Point> meshPoints;
-    SegmentMap* delaunayEdges;
 
     /*
      * Information for the computation of the Voronoi diagram
@@ -37,7 +32,7 @@ private:
     UniqueList<int> realPoints;
     std::vector<EdgeData> edges;
     UniqueList<Point> circumcenters;
-    std::unordered_map<Key, int, KeyHasher> edgeMap;
+    std::vector<int> circumcenterIndexes;
     bool empty = false;
 
     /* Calls the Triangle library, filling the class members with the result
@@ -95,16 +90,17 @@ public:
     Mesh<T> initializeMesh(){
         UniqueList<Point> points;
         PointMap* pointMap = new PointMap;
+        SegmentMap* delaunayEdges = new SegmentMap;
         std::vector<int> indexes = points.push_list(this->meshPoints);
+        int numberOfTriangles = triangulation? triangulation->numberOfTriangles() : 0;
 
         std::vector<T> polygons;
-        for (int i = 0;i<triangles.size();i++) {
-            Triangle t = triangles[i];
-            std::vector<int> oldPoints = t.getPoints();
-            std::vector<int> newPoints;
+        polygons.reserve(numberOfTriangles);
+        for (int i = 0;i<numberOfTriangles;i++) {
+            std::vector<int> newPoints(3);
 
-            for (int j = 0; j < oldPoints.size(); ++j) {
-                newPoints.push_back(indexes[oldPoints[j]]);
+            for (int j = 0; j < 3; ++j) {
+                newPoints[j] = indexes[triangulation->triangleVertex(i, j)];
                 pointMap->insert(meshPoints[newPoints[j]], i);
             }
 
@@ -112,7 +108,14 @@ public:
             polygons.push_back(T(newPoints, meshPoints));
         }
 
-        return Mesh<T>(points, polygons, this->delaunayEdges, pointMap);
+        for (int i = 0; i < edges.size(); ++i) {
+            delaunayEdges->insert(IndexSegment(edges[i].p1, edges[i].p2), NeighboursBySegment(edges[i].t1, edges[i].t2));
+        }
+
+        Mesh<T> mesh(points, polygons, delaunayEdges, pointMap);
+        mesh.reorder(DelynoiConfig::instance()->getMeshOrdering());
+
+        return mesh;
     };
 };
 
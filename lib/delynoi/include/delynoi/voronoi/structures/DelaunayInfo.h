@@ -1,7 +1,10 @@
 #ifndef DELYNOI_DELAUNAYINFO_H
 #define DELYNOI_DELAUNAYINFO_H
 
-#include <delynoi/models/polygon/Triangle.h>
+#include <delynoi/models/neighbourhood/EdgeData.h>
+#include <delynoi/voronoi/structures/TriangulationData.h>
+#include <utilities/UniqueList.h>
+#include <memory>
 #include "PointData.h"
 
 /*
@@ -10,20 +13,15 @@
  */
 struct DelaunayInfo{
     /*
-     * List of Delaunay triangles
+     * Output of Triangle (triangles, their neighbours and the index of their edges)
      */
-    std::vector<Triangle> triangles;
+    std::shared_ptr<TriangulationData> triangulation;
 
     /*
      * List of points of the Delaunay triangulation
      */
     std::vector<Point> meshPoints;
 
-    /*
-     * SegmentMap with the Delaunay neighbourhood information
-     */
-    SegmentMap* delaunayEdges;
-
     /*
      * List of PointData (point index and an associated segment index)
      */
@@ -41,28 +39,24 @@ struct DelaunayInfo{
     std::vector<EdgeData> edges;
 
     /*
-     * Map that relates edges endpoints and the index of the corresponding EdgeData
+     * Circumcenters of the triangles, and index of the circumcenter of each triangle
      */
-    std::unordered_map<Key, int, KeyHasher> edgeMap;
-
-
     UniqueList<Point> circumcenters;
+    std::vector<int> circumcenterIndexes;
 
     /*
      * Constructor
      */
-    DelaunayInfo(std::vector<Triangle>& t, std::vector<Point>& p, SegmentMap* e, std::vector<PointData>& pD,
-                 UniqueList<int>& rP, std::vector<EdgeData>& eD, std::unordered_map<Key, int, KeyHasher>& eM,
-                 UniqueList<Point>& c){
-        triangles = t;
+    DelaunayInfo(std::shared_ptr<TriangulationData> t, std::vector<Point>& p, std::vector<PointData>& pD,
+                 UniqueList<int>& rP, std::vector<EdgeData>& eD, UniqueList<Point>& c, std::vector<int>& cI){
+        triangulation = t;
         meshPoints = p;
-        delaunayEdges = e;
         points = pD;
         realPoints = rP;
         edges = eD;
-        edgeMap = eM;
         circumcenters = c;
+        circumcenterIndexes = cI;
     }
 };
 
-#endif
\ No newline at end of file
+#endif
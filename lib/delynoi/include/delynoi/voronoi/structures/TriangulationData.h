@@ -0,0 +1,105 @@
+#ifndef DELYNOI_TRIANGULATIONDATA_H
+#define DELYNOI_TRIANGULATIONDATA_H
+
+#include <delynoi/models/basic/Point.h>
+#include <vector>
+
+extern "C"{
+#include <delynoi/voronoi/lib/triangle.h>
+};
+
+/*
+ * Output of the Triangle library, used in place (the arrays are not copied): the class takes ownership of the arrays
+ * of a triangulateio structure and frees them when destroyed. Triangle must be called with the 'e' (edges) and 'n'
+ * (neighbours) switches; the neighbours are used to relate each edge to its incident triangles, so no map from edge
+ * endpoints to edge indexes is needed
+ */
+class TriangulationData {
+private:
+    /*
+     * Arrays returned by Triangle
+     */
+    struct triangulateio data;
+
+    /*
+     * For each triangle, index of the edge opposite to each of its three vertices
+     */
+    std::vector<int> triangleEdges;
+
+    /*
+     * For each edge, its two incident triangles (the one with the lowest index first, -1 on the boundary)
+     */
+    std::vector<int> edgeTriangles;
+
+    /*
+     * Computes the edges of each triangle and the triangles incident to each edge
+     */
+    void buildEdges();
+
+    /*
+     * Frees the arrays returned by Triangle
+     */
+    void release();
+public:
+    /*
+     * Constructor. Takes ownership of the output arrays of Triangle (the pointers in out are set to null)
+     * @param out output of the triangulate function
+     */
+    explicit TriangulationData(struct triangulateio& out);
+
+    /*
+     * Destructor. Frees the arrays returned by Triangle
+     */
+    ~TriangulationData();
+
+    /*
+     * The arrays are owned by a single instance
+     */
+    TriangulationData(const TriangulationData& other) = delete;
+    TriangulationData& operator=(const TriangulationData& other) = delete;
+
+    /*
+     * Point queries
+     * @param i point index
+     */
+    int numberOfPoints() const { return data.numberofpoints; }
+    double getX(int i) const { return data.pointlist[2*i]; }
+    double getY(int i) const { return data.pointlist[2*i+1]; }
+    bool isBoundaryPoint(int i) const { return data.pointmarkerlist!=nullptr && data.pointmarkerlist[i]==1; }
+
+    /*
+     * @param i point index
+     * @return the point, marked as boundary point if Triangle says so
+     */
+    Point getPoint(int i) const;
+
+    /*
+     * Triangle queries
+     * @param t triangle index
+     * @param k local index (0, 1 or 2) of a vertex
+     */
+    int numberOfTriangles() const { return data.numberoftriangles; }
+    int triangleVertex(int t, int k) const { return data.trianglelist[3*t+k]; }
+    int neighbour(int t, int k) const { return data.neighborlist[3*t+k]; }
+    int triangleEdge(int t, int k) const { return triangleEdges[3*t+k]; }
+
+    /* Gets the other edge of a triangle incident to one of its vertices
+     * @param t triangle index
+     * @param center vertex of the triangle
+     * @param edge index of one of the edges of t incident to center
+     * @return index of the other edge of t incident to center
+     */
+    int nextEdge(int t, int center, int edge) const;
+
+    /*
+     * Edge queries
+     * @param e edge index
+     */
+    int numberOfEdges() const { return data.numberofedges; }
+    int edgeFirst(int e) const { return data.edgelist[2*e]; }
+    int edgeSecond(int e) const { return data.edgelist[2*e+1]; }
+    int edgeMarker(int e) const { return data.edgemarkerlist!=nullptr? data.edgemarkerlist[e] : 0; }
+    int edgeTriangle(int e, int side) const { return edgeTriangles[2*e+side]; }
+};
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef DELYNOI_VORONOIUPDATE_H
+#define DELYNOI_VORONOIUPDATE_H
+
+#include <vector>
+
+/*
+ * Cells affected by an update of an IncrementalVoronoiGenerator (all lists are sorted, and contain cell ids)
+ */
+struct VoronoiUpdate {
+    /*
+     * Cells created by the update: the inserted seeds plus the points added on the boundary to keep the triangulation
+     * conforming
+     */
+    std::vector<int> insertedCells;
+
+    /*
+     * Cells removed by the update
+     */
+    std::vector<int> removedCells;
+
+    /*
+     * Cells whose geometry was recomputed (those whose Delaunay star changed, including the inserted ones)
+     */
+    std::vector<int> changedCells;
+
+    /*
+     * Seeds that a move left in place, as their new position is outside the domain
+     */
+    std::vector<int> skippedCells;
+};
+
+#endif
@@ -1,12 +1,15 @@
 #include <delynoi/config/DelynoiConfig.h>
 
-DelynoiConfig* DelynoiConfig::s_instance = nullptr;
+thread_local DelynoiConfig* DelynoiConfig::active = nullptr;
 
 DelynoiConfig::DelynoiConfig() {
     this->circle_discretization_grade = 12;
     this->double_comparison_tolerance = 0.00001;
     this->scale_for_clipper = 100000;
     this->precision = 6;
+    this->number_of_threads = 1;
+    this->mesh_ordering = MeshOrdering::Hilbert;
+    this->original_numbering = false;
 }
 
 void DelynoiConfig::setDiscretizationGrade(int d) {
@@ -29,12 +32,20 @@ void DelynoiConfig::setPrecision(int p) {
     this->precision = p;
 }
 
-int DelynoiConfig::getDiscretizationGrade() {
-    return this->circle_discretization_grade;
+void DelynoiConfig::setNumberOfThreads(int n) {
+    this->number_of_threads = n;
 }
 
-double DelynoiConfig::getTolerance() {
-    return this->double_comparison_tolerance;
+void DelynoiConfig::setMeshOrdering(MeshOrdering o) {
+    this->mesh_ordering = o;
+}
+
+void DelynoiConfig::setOriginalNumbering(bool o) {
+    this->original_numbering = o;
+}
+
+int DelynoiConfig::getDiscretizationGrade() {
+    return this->circle_discretization_grade;
 }
 
 int DelynoiConfig::getScale() {
@@ -45,10 +56,27 @@ int DelynoiConfig::getPrecision() {
     return this->precision;
 }
 
-DelynoiConfig *DelynoiConfig::instance() {
-    if(!s_instance){
-        s_instance = new DelynoiConfig;
-    }
+int DelynoiConfig::getNumberOfThreads() {
+    return this->number_of_threads;
+}
+
+MeshOrdering DelynoiConfig::getMeshOrdering() {
+    return this->mesh_ordering;
+}
+
+bool DelynoiConfig::useOriginalNumbering() {
+    return this->original_numbering;
+}
+
+DelynoiConfig *DelynoiConfig::defaultInstance() {
+    static DelynoiConfig s_instance;
+
+    return &s_instance;
+}
+
+DelynoiConfig *DelynoiConfig::activate(DelynoiConfig *config) {
+    DelynoiConfig* previous = active;
+    active = config;
 
-    return s_instance;
+    return previous;
 }
@@ -0,0 +1,754 @@
+#include <delynoi/models/MeshPartitioner.h>
+#include <utilities/Profiler.h>
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <stdexcept>
+
+namespace {
+    /*
+     * Weighted graph in compressed form: the neighbours of vertex v (and the weights of the edges that join them) are
+     * [offsets[v], offsets[v+1])
+     */
+    struct Graph {
+        std::vector<int> offsets;
+        std::vector<int> adjacency;
+        std::vector<int> edgeWeights;
+        std::vector<int> vertexWeights;
+
+        int size() const { return (int) vertexWeights.size(); }
+    };
+
+    /*
+     * Candidate moves of a refinement pass, by decreasing gain (and increasing vertex index on ties)
+     */
+    typedef std::priority_queue<std::pair<int,int>> MoveQueue;
+
+    /*
+     * Coarsening stops when the graph has this many vertices per part (or when it no longer shrinks)
+     */
+    const int verticesPerPart = 20;
+    const int minimumCoarseSize = 100;
+
+    /*
+     * Number of consecutive moves that do not improve the partition after which a refinement pass stops
+     */
+    const int maxUselessMoves = 64;
+
+    /*
+     * Number of starting vertices tried when splitting a graph in two
+     */
+    const int bisectionTrials = 4;
+
+    /* Builds the dual graph of a mesh: elements joined by the edges they share (edge weight: number of shared edges)
+     * @param topology topology of the mesh
+     * @param weights weight of each element (empty for unit weights)
+     * @return dual graph
+     */
+    Graph dualGraph(const MeshTopology& topology, const std::vector<int>& weights){
+        int n = topology.getNumberOfCells();
+        Graph graph;
+        std::vector<int> position(n, -1);
+
+        graph.offsets.reserve(n + 1);
+        graph.offsets.push_back(0);
+        graph.vertexWeights.resize(n);
+        for (int c = 0; c < n; ++c) {
+            int start = (int) graph.adjacency.size();
+
+            for (int j = 0; j < topology.cellSize(c); ++j) {
+                int neighbour = topology.neighbour(c, j);
+                if(neighbour<0 || neighbour==c){
+                    continue;
+                }
+
+                if(position[neighbour]>=start){
+                    graph.edgeWeights[position[neighbour]]++;
+                } else {
+                    position[neighbour] = (int) graph.adjacency.size();
+                    graph.adjacency.push_back(neighbour);
+                    graph.edgeWeights.push_back(1);
+                }
+            }
+
+            graph.offsets.push_back((int) graph.adjacency.size());
+            graph.vertexWeights[c] = weights.empty()? 1 : weights[c];
+        }
+
+        return graph;
+    }
+
+    /* Coarsens a graph matching each vertex with the unmatched neighbour joined by the heaviest edge
+     * @param graph graph to coarsen
+     * @param maxVertexWeight matched pairs can not be heavier than this
+     * @param map vector where the coarse vertex of each vertex is set
+     * @return coarse graph
+     */
+    Graph coarsen(const Graph& graph, int maxVertexWeight, std::vector<int>& map){
+        int n = graph.size();
+        std::vector<int> match(n, -1);
+
+        for (int u = 0; u < n; ++u) {
+            if(match[u]>=0){
+                continue;
+            }
+
+            int best = -1, bestWeight = 0;
+            for (int e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+                int v = graph.adjacency[e];
+                if(match[v]>=0 || graph.vertexWeights[u] + graph.vertexWeights[v]>maxVertexWeight){
+                    continue;
+                }
+
+                if(best<0 || graph.edgeWeights[e]>bestWeight ||
+                   (graph.edgeWeights[e]==bestWeight && graph.vertexWeights[v]<graph.vertexWeights[best])){
+                    best = v;
+                    bestWeight = graph.edgeWeights[e];
+                }
+            }
+
+            match[u] = best<0? u : best;
+            if(best>=0){
+                match[best] = u;
+            }
+        }
+
+        // Coarse vertices are numbered by their first fine vertex, so the coarse graph keeps the order of the fine one
+        map.assign(n, -1);
+        int coarseSize = 0;
+        for (int u = 0; u < n; ++u) {
+            if(map[u]<0){
+                map[u] = map[match[u]] = coarseSize++;
+            }
+        }
+
+        Graph coarse;
+        std::vector<int> position(coarseSize, -1);
+        coarse.offsets.reserve(coarseSize + 1);
+        coarse.offsets.push_back(0);
+        coarse.vertexWeights.reserve(coarseSize);
+        for (int u = 0; u < n; ++u) {
+            if(match[u]<u){
+                continue;
+            }
+
+            int c = map[u];
+            int start = (int) coarse.adjacency.size();
+            int members[2] = {u, match[u]};
+            int count = match[u]==u? 1 : 2;
+            int weight = 0;
+
+            for (int m = 0; m < count; ++m) {
+                int x = members[m];
+                weight += graph.vertexWeights[x];
+
+                for (int e = graph.offsets[x]; e < graph.offsets[x + 1]; ++e) {
+                    int v = map[graph.adjacency[e]];
+                    if(v==c){
+                        continue;
+                    }
+
+                    if(position[v]>=start){
+                        coarse.edgeWeights[position[v]] += graph.edgeWeights[e];
+                    } else {
+                        position[v] = (int) coarse.adjacency.size();
+                        coarse.adjacency.push_back(v);
+                        coarse.edgeWeights.push_back(graph.edgeWeights[e]);
+                    }
+                }
+            }
+
+            coarse.offsets.push_back((int) coarse.adjacency.size());
+            coarse.vertexWeights.push_back(weight);
+        }
+
+        return coarse;
+    }
+
+    /* Finds a vertex far from another one, walking in breadth first order through unassigned vertices
+     * @param graph graph
+     * @param part part of each vertex (-1 if unassigned)
+     * @param start unassigned vertex where the walk starts
+     * @param visited work vector (one value per vertex), used to mark the visited vertices
+     * @param stamp value that marks the vertices visited in this walk
+     * @return last vertex reached
+     */
+    int peripheralVertex(const Graph& graph, const std::vector<int>& part, int start, std::vector<int>& visited,
+                         int stamp){
+        std::vector<int> queue(1, start);
+        visited[start] = stamp;
+
+        for (int i = 0; i < (int) queue.size(); ++i) {
+            int u = queue[i];
+
+            for (int e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+                int v = graph.adjacency[e];
+                if(part[v]<0 && visited[v]!=stamp){
+                    visited[v] = stamp;
+                    queue.push_back(v);
+                }
+            }
+        }
+
+        return queue.back();
+    }
+
+    /*
+     * @return weight of the edges that join vertices of different parts
+     */
+    long long edgeCut(const Graph& graph, const std::vector<int>& part){
+        long long cut = 0;
+
+        for (int u = 0; u < graph.size(); ++u) {
+            for (int e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+                if(graph.adjacency[e]>u && part[graph.adjacency[e]]!=part[u]){
+                    cut += graph.edgeWeights[e];
+                }
+            }
+        }
+
+        return cut;
+    }
+
+    /* Computes the total weight over the maximum of each part
+     * @param partWeights weight of each part
+     * @param maxWeights maximum weight of each part
+     * @return total excess of weight
+     */
+    long long overload(const std::vector<long long>& partWeights, const std::vector<long long>& maxWeights){
+        long long total = 0;
+        for (int p = 0; p < (int) partWeights.size(); ++p) {
+            total += std::max(0LL, partWeights[p] - maxWeights[p]);
+        }
+
+        return total;
+    }
+
+    /*
+     * Fiduccia-Mattheyses refinement of a k-way partition
+     */
+    class Refiner {
+    private:
+        const Graph& graph;
+        std::vector<int>& part;
+        std::vector<long long> maxWeights;
+        std::vector<long long> partWeights;
+
+        /*
+         * Connection of the vertex being evaluated to each part, and the parts it touches
+         */
+        std::vector<int> connection;
+        std::vector<int> touched;
+
+        /*
+         * @return weight of a part over its maximum (zero if it is not too heavy)
+         */
+        long long excess(int p) const {
+            return std::max(0LL, this->partWeights[p] - this->maxWeights[p]);
+        }
+
+        /* Finds the best move of a vertex to a neighbouring part. Normally the destination must stay within its maximum
+         * weight (or end with less excess than the part of the vertex); when balancing, the vertex must be in a part that
+         * is too heavy and the destination must end lighter than that part was, preferring parts that stay within their
+         * maximum. Parts are never left empty
+         * @param u vertex
+         * @param balancing whether the move is looked for to balance the parts
+         * @param to variable where the destination part is set
+         * @param gain variable where the reduction of the edge cut is set
+         * @return whether the vertex can be moved
+         */
+        bool bestMove(int u, bool balancing, int& to, int& gain){
+            int from = this->part[u];
+            long long weight = this->graph.vertexWeights[u];
+
+            for (int e = this->graph.offsets[u]; e < this->graph.offsets[u + 1]; ++e) {
+                int p = this->part[this->graph.adjacency[e]];
+                if(this->connection[p]==0){
+                    this->touched.push_back(p);
+                }
+                this->connection[p] += this->graph.edgeWeights[e];
+            }
+
+            int internal = this->connection[from];
+            bool toFits = false;
+            to = -1;
+            if(this->partWeights[from]>weight && (!balancing || excess(from)>0)){
+                for(int p: this->touched){
+                    if(p==from){
+                        continue;
+                    }
+
+                    long long after = this->partWeights[p] + weight - this->maxWeights[p];
+                    bool fits = after<=0;
+                    if(balancing? this->partWeights[p] + weight>=this->partWeights[from] : !fits && after>=excess(from)){
+                        continue;
+                    }
+
+                    if(to<0 || (fits && !toFits) || (fits==toFits &&
+                       (this->connection[p]>this->connection[to] || (this->connection[p]==this->connection[to] &&
+                        (this->partWeights[p]<this->partWeights[to] ||
+                         (this->partWeights[p]==this->partWeights[to] && p<to)))))){
+                        to = p;
+                        toFits = fits;
+                    }
+                }
+            }
+
+            gain = to<0? 0 : this->connection[to] - internal;
+            for(int p: this->touched){
+                this->connection[p] = 0;
+            }
+            this->touched.clear();
+
+            return to>=0;
+        }
+
+        /* Moves a vertex to another part
+         * @param u vertex
+         * @param to destination part
+         */
+        void move(int u, int to){
+            this->partWeights[this->part[u]] -= this->graph.vertexWeights[u];
+            this->partWeights[to] += this->graph.vertexWeights[u];
+            this->part[u] = to;
+        }
+
+        /*
+         * Pushes the best move of a vertex, if it has one, in the queue
+         */
+        void pushMove(int u, bool balancing, MoveQueue& queue){
+            int to, gain;
+            if(bestMove(u, balancing, to, gain)){
+                queue.push(std::make_pair(gain, -u));
+            }
+        }
+
+        /*
+         * @return whether a vertex has neighbours in other parts
+         */
+        bool isBoundary(int u) const {
+            for (int e = this->graph.offsets[u]; e < this->graph.offsets[u + 1]; ++e) {
+                if(this->part[this->graph.adjacency[e]]!=this->part[u]){
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    public:
+        Refiner(const Graph& graph, const std::vector<long long>& maxWeights, std::vector<int>& part) :
+                graph(graph), part(part) {
+            this->maxWeights = maxWeights;
+            this->partWeights.assign(maxWeights.size(), 0);
+            this->connection.assign(maxWeights.size(), 0);
+
+            for (int u = 0; u < graph.size(); ++u) {
+                this->partWeights[part[u]] += graph.vertexWeights[u];
+            }
+        }
+
+        /* Moves vertices out of the parts that are too heavy (each move leaves the destination lighter than the origin
+         * was, so the moves always end), by decreasing gain. A part that becomes too heavy passes the excess on
+         */
+        void balance(){
+            MoveQueue queue;
+            for (int u = 0; u < this->graph.size(); ++u) {
+                if(excess(this->part[u])>0 && isBoundary(u)){
+                    pushMove(u, true, queue);
+                }
+            }
+
+            long long total = overload(this->partWeights, this->maxWeights);
+            while(!queue.empty() && total>0){
+                int u = -queue.top().second, queuedGain = queue.top().first;
+                queue.pop();
+
+                int to, gain;
+                if(!bestMove(u, true, to, gain)){
+                    continue;
+                }
+                if(gain!=queuedGain){
+                    queue.push(std::make_pair(gain, -u));
+                    continue;
+                }
+
+                int from = this->part[u];
+                long long before = excess(from) + excess(to);
+                move(u, to);
+                total += excess(from) + excess(to) - before;
+
+                for (int e = this->graph.offsets[u]; e < this->graph.offsets[u + 1]; ++e) {
+                    pushMove(this->graph.adjacency[e], true, queue);
+                }
+                pushMove(u, true, queue);
+            }
+        }
+
+        /* Runs a pass: boundary vertices are moved by decreasing gain (each one at most once, even if the edge cut
+         * grows, to escape local minima), and the moves after the best partition found are undone
+         * @return whether the pass improved the partition
+         */
+        bool pass(){
+            int n = this->graph.size();
+            MoveQueue queue;
+            std::vector<char> moved(n, false);
+            std::vector<std::pair<int,int>> moves;
+
+            for (int u = 0; u < n; ++u) {
+                if(isBoundary(u)){
+                    pushMove(u, false, queue);
+                }
+            }
+
+            long long currentOverload = overload(this->partWeights, this->maxWeights), bestOverload = currentOverload;
+            long long cutChange = 0, bestCutChange = 0;
+            int bestMoves = 0;
+
+            while(!queue.empty() && (int) moves.size() - bestMoves<maxUselessMoves){
+                int u = -queue.top().second, queuedGain = queue.top().first;
+                queue.pop();
+                if(moved[u]){
+                    continue;
+                }
+
+                // Moves in the queue may be outdated by later moves of the neighbours
+                int to, gain;
+                if(!bestMove(u, false, to, gain)){
+                    continue;
+                }
+                if(gain!=queuedGain){
+                    queue.push(std::make_pair(gain, -u));
+                    continue;
+                }
+
+                int from = this->part[u];
+                long long before = excess(from) + excess(to);
+                move(u, to);
+                moved[u] = true;
+                moves.push_back(std::make_pair(u, from));
+                currentOverload += excess(from) + excess(to) - before;
+                cutChange -= gain;
+
+                if(currentOverload<bestOverload || (currentOverload==bestOverload && cutChange<bestCutChange)){
+                    bestOverload = currentOverload;
+                    bestCutChange = cutChange;
+                    bestMoves = (int) moves.size();
+                }
+
+                for (int e = this->graph.offsets[u]; e < this->graph.offsets[u + 1]; ++e) {
+                    int v = this->graph.adjacency[e];
+                    if(!moved[v]){
+                        pushMove(v, false, queue);
+                    }
+                }
+            }
+
+            for (int i = (int) moves.size() - 1; i >= bestMoves; --i) {
+                move(moves[i].first, moves[i].second);
+            }
+
+            return bestMoves>0;
+        }
+    };
+
+    /* Refines a partition: balances it first, and then improves it with several Fiduccia-Mattheyses passes
+     * @param graph partitioned graph
+     * @param maxWeights maximum weight of each part
+     * @param passes maximum number of passes
+     * @param part part of each vertex
+     */
+    void refine(const Graph& graph, const std::vector<long long>& maxWeights, int passes, std::vector<int>& part){
+        Refiner refiner(graph, maxWeights, part);
+
+        refiner.balance();
+        for (int i = 0; i < passes; ++i) {
+            if(!refiner.pass()){
+                break;
+            }
+        }
+    }
+
+    /* Computes the maximum weight of a part: the allowed imbalance over its target weight, but never less than the
+     * target plus the heaviest vertex (otherwise coarse graphs could not be balanced at all)
+     * @param graph partitioned graph
+     * @param target target weight of the part
+     * @param imbalance allowed relative excess of weight
+     * @return maximum weight of the part
+     */
+    long long maxPartWeight(const Graph& graph, double target, double imbalance){
+        int heaviest = *std::max_element(graph.vertexWeights.begin(), graph.vertexWeights.end());
+
+        return std::max((long long) ((1 + imbalance)*target), (long long) std::ceil(target) + heaviest);
+    }
+
+    /* Splits a graph in two parts growing the first one from a peripheral vertex, always adding the vertex that is most
+     * connected to it, until it reaches its target weight. Several starting vertices are tried, and the best split
+     * (after refining it) is kept
+     * @param graph graph to split
+     * @param target target weight of the first part
+     * @param maxWeights maximum weight of each part
+     * @param passes maximum number of refinement passes
+     * @param part vector where the part (zero or one) of each vertex is set
+     */
+    void bisect(const Graph& graph, long long target, const std::vector<long long>& maxWeights, int passes,
+                std::vector<int>& part){
+        int n = graph.size();
+        int trials = std::min(n, bisectionTrials);
+        std::vector<int> degree(n, 0), connection(n, 0), visited(n, -1), trial;
+        long long bestOverload = 0, bestCut = 0;
+
+        for (int u = 0; u < n; ++u) {
+            for (int e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+                degree[u] += graph.edgeWeights[e];
+            }
+        }
+
+        // Gain of adding a vertex: edges to the part minus edges to the rest of the graph
+        auto gain = [&](int u){
+            return 2*connection[u] - degree[u];
+        };
+
+        for (int t = 0; t < trials; ++t) {
+            long long weight = 0;
+            int next = 0;
+            MoveQueue queue;
+            trial.assign(n, -1);
+            std::fill(connection.begin(), connection.end(), 0);
+
+            int seed = peripheralVertex(graph, trial, (int) ((long long) t*n/trials), visited, t);
+            queue.push(std::make_pair(gain(seed), -seed));
+            while(weight<target){
+                // When a connected component is exhausted, the part continues in the next one
+                if(queue.empty()){
+                    while(next<n && trial[next]>=0){
+                        next++;
+                    }
+                    if(next==n){
+                        break;
+                    }
+                    queue.push(std::make_pair(gain(next), -next));
+                }
+
+                int u = -queue.top().second, g = queue.top().first;
+                queue.pop();
+                if(trial[u]>=0 || g!=gain(u)){
+                    continue;
+                }
+                if(weight>0 && weight + graph.vertexWeights[u]>maxWeights[0]){
+                    break;
+                }
+
+                trial[u] = 0;
+                weight += graph.vertexWeights[u];
+                for (int e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+                    int v = graph.adjacency[e];
+                    if(trial[v]<0){
+                        connection[v] += graph.edgeWeights[e];
+                        queue.push(std::make_pair(gain(v), -v));
+                    }
+                }
+            }
+
+            for (int u = 0; u < n; ++u) {
+                trial[u] = trial[u]<0? 1 : trial[u];
+            }
+            refine(graph, maxWeights, passes, trial);
+
+            std::vector<long long> partWeights(2, 0);
+            for (int u = 0; u < n; ++u) {
+                partWeights[trial[u]] += graph.vertexWeights[u];
+            }
+
+            long long trialOverload = overload(partWeights, maxWeights), trialCut = edgeCut(graph, trial);
+            if(t==0 || trialOverload<bestOverload || (trialOverload==bestOverload && trialCut<bestCut)){
+                bestOverload = trialOverload;
+                bestCut = trialCut;
+                part.swap(trial);
+            }
+        }
+    }
+
+    /* Builds the subgraph induced by a set of vertices
+     * @param graph graph
+     * @param vertices vertices of the subgraph (vertex i of the subgraph is vertices[i])
+     * @param local work vector (one value per vertex of the graph, -1 on entry and on exit)
+     * @return subgraph
+     */
+    Graph subgraph(const Graph& graph, const std::vector<int>& vertices, std::vector<int>& local){
+        Graph sub;
+        for (int i = 0; i < (int) vertices.size(); ++i) {
+            local[vertices[i]] = i;
+        }
+
+        sub.offsets.push_back(0);
+        for(int u: vertices){
+            for (int e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+                int v = local[graph.adjacency[e]];
+                if(v>=0){
+                    sub.adjacency.push_back(v);
+                    sub.edgeWeights.push_back(graph.edgeWeights[e]);
+                }
+            }
+
+            sub.offsets.push_back((int) sub.adjacency.size());
+            sub.vertexWeights.push_back(graph.vertexWeights[u]);
+        }
+
+        for(int u: vertices){
+            local[u] = -1;
+        }
+
+        return sub;
+    }
+
+    /* Partitions a (coarse) graph by recursive bisection: each set of vertices is split in two, with weights
+     * proportional to the number of parts each half will be split into
+     * @param graph graph to partition
+     * @param vertices vertices to split
+     * @param numberOfParts number of parts of the vertices
+     * @param firstPart index of the first of those parts
+     * @param imbalance allowed relative excess of weight of each half
+     * @param passes maximum number of refinement passes
+     * @param local work vector (one value per vertex, -1)
+     * @param part vector where the part of each vertex is set
+     */
+    void recursiveBisection(const Graph& graph, const std::vector<int>& vertices, int numberOfParts, int firstPart,
+                            double imbalance, int passes, std::vector<int>& local, std::vector<int>& part){
+        if(numberOfParts==1 || vertices.size()<2){
+            for(int u: vertices){
+                part[u] = firstPart;
+            }
+            return;
+        }
+
+        Graph sub = subgraph(graph, vertices, local);
+        long long total = 0;
+        for(int w: sub.vertexWeights){
+            total += w;
+        }
+
+        int firstHalf = numberOfParts/2;
+        double target = (double) total*firstHalf/numberOfParts;
+        std::vector<long long> maxWeights = {maxPartWeight(sub, target, imbalance),
+                                             maxPartWeight(sub, total - target, imbalance)};
+
+        std::vector<int> halves;
+        bisect(sub, (long long) target, maxWeights, passes, halves);
+
+        std::vector<int> first, second;
+        for (int i = 0; i < (int) vertices.size(); ++i) {
+            (halves[i]==0? first : second).push_back(vertices[i]);
+        }
+
+        recursiveBisection(graph, first, firstHalf, firstPart, imbalance, passes, local, part);
+        recursiveBisection(graph, second, numberOfParts - firstHalf, firstPart + firstHalf, imbalance, passes, local,
+                           part);
+    }
+}
+
+MeshPartitioner::MeshPartitioner(double imbalance, int refinementPasses) {
+    this->imbalance = imbalance;
+    this->refinementPasses = refinementPasses;
+}
+
+MeshPartition MeshPartitioner::partition(const MeshTopology &topology, int numberOfParts,
+                                         const std::vector<int> &weights) const {
+    PROFILE_PHASE("mesh partitioning");
+    int n = topology.getNumberOfCells();
+    if(numberOfParts<1 || numberOfParts>n){
+        throw std::invalid_argument("The number of parts must be between one and the number of elements");
+    }
+    if(!weights.empty() && (int) weights.size()!=n){
+        throw std::invalid_argument("There must be one weight per element");
+    }
+
+    std::vector<Graph> levels(1, dualGraph(topology, weights));
+    std::vector<std::vector<int>> maps;
+
+    long long totalWeight = 0;
+    for(int w: levels[0].vertexWeights){
+        totalWeight += w;
+    }
+
+    // Coarsening
+    int coarseSize = std::max(verticesPerPart*numberOfParts, minimumCoarseSize);
+    int maxVertexWeight = std::max(1, (int) (1.5*totalWeight/coarseSize));
+    while(levels.back().size()>coarseSize){
+        std::vector<int> map;
+        Graph coarse = coarsen(levels.back(), maxVertexWeight, map);
+
+        if(coarse.size()>0.95*levels.back().size()){
+            break;
+        }
+
+        levels.push_back(coarse);
+        maps.push_back(map);
+    }
+
+    // Initial partition of the coarsest graph, refined while it is projected back to the finer ones
+    std::vector<int> part(levels.back().size());
+    std::vector<int> vertices(levels.back().size()), local(levels.back().size(), -1);
+    for (int u = 0; u < (int) vertices.size(); ++u) {
+        vertices[u] = u;
+    }
+    recursiveBisection(levels.back(), vertices, numberOfParts, 0, this->imbalance, this->refinementPasses, local, part);
+
+    for (int level = (int) levels.size() - 1; level >= 0; --level) {
+        const Graph& graph = levels[level];
+
+        if(level<(int) levels.size() - 1){
+            std::vector<int> finePart(graph.size());
+            for (int u = 0; u < graph.size(); ++u) {
+                finePart[u] = part[maps[level][u]];
+            }
+            part.swap(finePart);
+        }
+
+        double target = (double) totalWeight/numberOfParts;
+        refine(graph, std::vector<long long>(numberOfParts, maxPartWeight(graph, target, this->imbalance)),
+               this->refinementPasses, part);
+    }
+
+    MeshPartition partition;
+    partition.numberOfParts = numberOfParts;
+    partition.parts = part;
+    partition.edgeCut = (int) edgeCut(levels[0], part);
+
+    // Interface nodes: points whose cells are in more than one part, counted first and then listed
+    int points = topology.getNumberOfVertices();
+    partition.interfaceOffsets.assign(numberOfParts + 1, 0);
+    std::vector<int> next;
+    std::vector<int> vertexParts;
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int v = 0; v < points; ++v) {
+            vertexParts.clear();
+            for(int c: topology.vertexStar(v)){
+                if(std::find(vertexParts.begin(), vertexParts.end(), part[c])==vertexParts.end()){
+                    vertexParts.push_back(part[c]);
+                }
+            }
+
+            if(vertexParts.size()<2){
+                continue;
+            }
+
+            for(int p: vertexParts){
+                if(pass==0){
+                    partition.interfaceOffsets[p + 1]++;
+                } else {
+                    partition.interfaceNodes[next[p]++] = v;
+                }
+            }
+        }
+
+        if(pass==0){
+            for (int p = 0; p < numberOfParts; ++p) {
+                partition.interfaceOffsets[p + 1] += partition.interfaceOffsets[p];
+            }
+            partition.interfaceNodes.resize(partition.interfaceOffsets.back());
+            next.assign(partition.interfaceOffsets.begin(), partition.interfaceOffsets.end() - 1);
+        }
+    }
+
+    return partition;
+}
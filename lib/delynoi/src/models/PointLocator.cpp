@@ -0,0 +1,314 @@
+#include <delynoi/models/PointLocator.h>
+#include <delynoi/models/basic/IndexSegment.h>
+#include <delynoi/config/DelynoiConfig.h>
+#include <delynoi/utilities/parallel.h>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    /*
+     * Number of elements crossed when walking from a hint before searching in the grid
+     */
+    const int maxWalkSteps = 8;
+
+    double cross(const Point& o, const Point& a, const Point& b){
+        return (a.getX() - o.getX())*(b.getY() - o.getY()) - (a.getY() - o.getY())*(b.getX() - o.getX());
+    }
+}
+
+PointLocator::PointLocator(const std::vector<Point> &points, const MeshTopology &topology) {
+    double tolerance = DelynoiConfig::instance()->getTolerance();
+    int n = topology.getNumberOfCells();
+    this->points = points;
+
+    this->elementOffsets.reserve(n + 1);
+    this->elementOffsets.push_back(0);
+    this->orientation.resize(n);
+    this->boxes.resize(4*n);
+    for (int c = 0; c < n; ++c) {
+        IndexRange vertices = topology.cellVertices(c);
+        double* box = &this->boxes[4*c];
+        double area = 0;
+
+        box[0] = box[2] = points[vertices[0]].getX();
+        box[1] = box[3] = points[vertices[0]].getY();
+        for (int j = 0; j < vertices.size(); ++j) {
+            const Point& p = points[vertices[j]];
+            const Point& q = points[vertices[(j + 1)%vertices.size()]];
+            area += p.getX()*q.getY() - q.getX()*p.getY();
+
+            box[0] = std::min(box[0], p.getX());
+            box[1] = std::min(box[1], p.getY());
+            box[2] = std::max(box[2], p.getX());
+            box[3] = std::max(box[3], p.getY());
+
+            this->elementVertices.push_back(vertices[j]);
+            this->elementNeighbours.push_back(topology.neighbour(c, j));
+        }
+
+        box[0] -= tolerance;
+        box[1] -= tolerance;
+        box[2] += tolerance;
+        box[3] += tolerance;
+        this->orientation[c] = area<0? -1 : 1;
+        this->elementOffsets.push_back((int) this->elementVertices.size());
+    }
+
+    // Grid over the bounding box of the mesh, with about one element per cell
+    double xMax = 0, yMax = 0;
+    this->xMin = 0;
+    this->yMin = 0;
+    if(n>0){
+        this->xMin = this->boxes[0];
+        this->yMin = this->boxes[1];
+        xMax = this->boxes[2];
+        yMax = this->boxes[3];
+    }
+    for (int c = 1; c < n; ++c) {
+        this->xMin = std::min(this->xMin, this->boxes[4*c]);
+        this->yMin = std::min(this->yMin, this->boxes[4*c + 1]);
+        xMax = std::max(xMax, this->boxes[4*c + 2]);
+        yMax = std::max(yMax, this->boxes[4*c + 3]);
+    }
+
+    double width = xMax - this->xMin, height = yMax - this->yMin;
+    this->cellSize = std::max(std::sqrt(width*height/std::max(n, 1)), std::max(width, height)/std::max(n, 1));
+    if(this->cellSize<=0){
+        this->cellSize = 1;
+    }
+    this->nX = (int) (width/this->cellSize) + 1;
+    this->nY = (int) (height/this->cellSize) + 1;
+
+    // Elements of each cell, counted first and then listed in increasing order
+    this->cellOffsets.assign(this->nX*this->nY + 1, 0);
+    for (int pass = 0; pass < 2; ++pass) {
+        std::vector<int> next(this->cellOffsets.begin(), this->cellOffsets.end() - 1);
+
+        for (int c = 0; c < n; ++c) {
+            const double* box = &this->boxes[4*c];
+            int i0 = cellX(box[0]), j0 = cellY(box[1]), i1 = cellX(box[2]), j1 = cellY(box[3]);
+
+            for (int j = j0; j <= j1; ++j) {
+                for (int i = i0; i <= i1; ++i) {
+                    if(pass==0){
+                        this->cellOffsets[j*this->nX + i + 1]++;
+                    } else {
+                        this->cellElements[next[j*this->nX + i]++] = c;
+                    }
+                }
+            }
+        }
+
+        if(pass==0){
+            for (int i = 0; i < this->nX*this->nY; ++i) {
+                this->cellOffsets[i + 1] += this->cellOffsets[i];
+            }
+            this->cellElements.resize(this->cellOffsets.back());
+        }
+    }
+}
+
+int PointLocator::cellX(double x) const {
+    return std::max(0, std::min(this->nX - 1, (int) std::floor((x - this->xMin)/this->cellSize)));
+}
+
+int PointLocator::cellY(double y) const {
+    return std::max(0, std::min(this->nY - 1, (int) std::floor((y - this->yMin)/this->cellSize)));
+}
+
+bool PointLocator::contains(int element, const Point &p) const {
+    int first = this->elementOffsets[element], n = this->elementOffsets[element + 1] - first;
+    const int* vertices = this->elementVertices.data() + first;
+    bool oddNodes = false;
+
+    // Same crossing test as Polygon::containsPoint
+    for (int i = 0, j = n - 1; i < n; j = i++) {
+        const Point& pI = this->points[vertices[i]];
+        const Point& pJ = this->points[vertices[j]];
+
+        if(pI == pJ){
+            continue;
+        }
+
+        if ((pI.getY()<=p.getY() && pJ.getY()>p.getY()) || (pJ.getY()<=p.getY() && pI.getY()>p.getY())) {
+            if (pI.getX() + (p.getY()-pI.getY())/(pJ.getY()-pI.getY())*(pJ.getX()-pI.getX())<p.getX()){
+                oddNodes = !oddNodes;
+            }
+        }
+    }
+
+    return oddNodes || inEdges(element, p);
+}
+
+bool PointLocator::inEdges(int element, const Point &p) const {
+    int first = this->elementOffsets[element], n = this->elementOffsets[element + 1] - first;
+    const int* vertices = this->elementVertices.data() + first;
+
+    for (int i = 0; i < n; ++i) {
+        if(IndexSegment(vertices[i], vertices[(i + 1)%n]).contains(this->points, p)){
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int PointLocator::search(const Point &p) const {
+    double i = std::floor((p.getX() - this->xMin)/this->cellSize);
+    double j = std::floor((p.getY() - this->yMin)/this->cellSize);
+    if(i<0 || j<0 || i>=this->nX || j>=this->nY){
+        return -1;
+    }
+
+    int cell = (int) j*this->nX + (int) i;
+    for (int k = this->cellOffsets[cell]; k < this->cellOffsets[cell + 1]; ++k) {
+        int c = this->cellElements[k];
+        const double* box = &this->boxes[4*c];
+
+        if(p.getX()<box[0] || p.getY()<box[1] || p.getX()>box[2] || p.getY()>box[3]){
+            continue;
+        }
+
+        if(contains(c, p)){
+            return c;
+        }
+    }
+
+    return -1;
+}
+
+int PointLocator::walk(const Point &p, int start) const {
+    int current = start, previous = -1;
+
+    for (int step = 0; step < maxWalkSteps; ++step) {
+        int first = this->elementOffsets[current], n = this->elementOffsets[current + 1] - first;
+        const int* vertices = this->elementVertices.data() + first;
+        int next = -1;
+
+        for (int j = 0; j < n && next<0; ++j) {
+            int neighbour = this->elementNeighbours[first + j];
+            if(neighbour<0 || neighbour==previous){
+                continue;
+            }
+
+            if(this->orientation[current]*cross(this->points[vertices[j]], this->points[vertices[(j + 1)%n]], p)<0){
+                next = neighbour;
+            }
+        }
+
+        // With no edge left to cross, the point is in the element (if it is convex) or the walk is stuck
+        if(next<0){
+            return contains(current, p)? current : -1;
+        }
+
+        previous = current;
+        current = next;
+    }
+
+    return -1;
+}
+
+int PointLocator::locate(const Point &p, int hint) const {
+    // The walk may end in any of the elements that share a point on their edges, so those points are searched again
+    if(hint>=0 && hint<this->orientation.size()){
+        int element = walk(p, hint);
+
+        if(element>=0 && !inEdges(element, p)){
+            return element;
+        }
+    }
+
+    return search(p);
+}
+
+void PointLocator::getCoordinates(int element, const Point &p, double *coordinates) const {
+    int first = this->elementOffsets[element], n = this->elementOffsets[element + 1] - first;
+    const int* vertices = this->elementVertices.data() + first;
+
+    // Mean value coordinates: w_i = (tan(a_{i-1}/2) + tan(a_i/2))/r_i, where r_i is the distance to vertex i and a_i the
+    // angle at p between vertices i and i+1. tan(a/2) is computed as sin(a)/(1 + cos(a)) or (1 - cos(a))/sin(a),
+    // whichever does not cancel, so points close to the edges (where the weights grow) keep their accuracy
+    auto distance = [&](int i){
+        const Point& v = this->points[vertices[i]];
+        return std::hypot(v.getX() - p.getX(), v.getY() - p.getY());
+    };
+    auto tangent = [&](int i, int j){
+        const Point& a = this->points[vertices[i]];
+        const Point& b = this->points[vertices[j]];
+        double area = cross(p, a, b);
+        double dot = (a.getX() - p.getX())*(b.getX() - p.getX()) + (a.getY() - p.getY())*(b.getY() - p.getY());
+        double rr = distance(i)*distance(j);
+
+        return dot>=0? area/(rr + dot) : (rr - dot)/area;
+    };
+
+    std::fill(coordinates, coordinates + n, 0.0);
+    for (int i = 0; i < n; ++i) {
+        int j = (i + 1)%n;
+        const Point& a = this->points[vertices[i]];
+        const Point& b = this->points[vertices[j]];
+
+        if(p.getX()==a.getX() && p.getY()==a.getY()){
+            coordinates[i] = 1;
+            return;
+        }
+
+        // Exactly on an edge the coordinates are linear between its endpoints
+        double dot = (a.getX() - p.getX())*(b.getX() - p.getX()) + (a.getY() - p.getY())*(b.getY() - p.getY());
+        if(cross(p, a, b)==0 && dot<0){
+            double da = distance(i), db = distance(j);
+            coordinates[i] = db/(da + db);
+            coordinates[j] = da/(da + db);
+            return;
+        }
+    }
+
+    double sum = 0;
+    double previous = tangent(n - 1, 0);
+    for (int i = 0; i < n; ++i) {
+        double next = tangent(i, (i + 1)%n);
+
+        coordinates[i] = (previous + next)/distance(i);
+        sum += coordinates[i];
+        previous = next;
+    }
+    for (int i = 0; i < n; ++i) {
+        coordinates[i] /= sum;
+    }
+}
+
+void PointLocator::locate(const std::vector<Point> &queries, std::vector<int> &elements) const {
+    int n = (int) queries.size();
+    elements.resize(n);
+
+    delynoi_utilities::parallelFor(n, delynoi_utilities::numberOfThreads(), [&](int begin, int end){
+        int hint = -1;
+
+        for (int i = begin; i < end; ++i) {
+            elements[i] = locate(queries[i], hint);
+            hint = elements[i]>=0? elements[i] : hint;
+        }
+    });
+}
+
+void PointLocator::locate(const std::vector<Point> &queries, PointLocations &locations) const {
+    int n = (int) queries.size();
+    int threads = delynoi_utilities::numberOfThreads();
+    locate(queries, locations.elements);
+
+    locations.offsets.resize(n + 1);
+    locations.offsets[0] = 0;
+    for (int i = 0; i < n; ++i) {
+        int element = locations.elements[i];
+        locations.offsets[i + 1] = locations.offsets[i] + (element<0? 0 : elementSize(element));
+    }
+    locations.coordinates.resize(locations.offsets.back());
+
+    delynoi_utilities::parallelFor(n, threads, [&](int begin, int end){
+        for (int i = begin; i < end; ++i) {
+            if(locations.elements[i]>=0){
+                getCoordinates(locations.elements[i], queries[i], locations.coordinates.data() + locations.offsets[i]);
+            }
+        }
+    });
+}
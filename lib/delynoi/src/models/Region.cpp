@@ -1,4 +1,7 @@
 #include <delynoi/models/Region.h>
+#include <utilities/BufferedWriter.h>
+#include <utilities/Profiler.h>
+#include <delynoi/utilities/parallel.h>
 
 Region::Region(std::vector<Point>& points) : Polygon(points){
     this->p = points;
@@ -6,6 +9,7 @@ Region::Region(std::vector<Point>& points) : Polygon(points){
 
 void Region::mutate(std::vector<Point> &points) {
     this->p = points;
+    this->classifier.reset();
     Polygon::mutate(points);
 }
 
@@ -25,9 +29,11 @@ Region::Region(const Polygon &other, std::vector<Point>& points) : Polygon() {
 Region::Region(const Region &other) : Polygon(other){
     this->p = other.p;
     this->holes.assign(other.holes.begin(), other.holes.end());
+    this->classifier = other.classifier;
 }
 
 std::vector<Hole>& Region::getHoles() {
+    this->classifier.reset();
     return this->holes;
 }
 
@@ -73,6 +79,7 @@ void Region::addHole(Hole h) {
 
         if(Polygon::containsPoint(this->p, h.getCenter())){
             this->holes.push_back(h);
+            this->classifier.reset();
         }else{
             throw std::invalid_argument("Hole lies completely outside of domain region");
         }
@@ -81,14 +88,22 @@ void Region::addHole(Hole h) {
 
 void Region::cleanInternalHoles() {
     this->holes.clear();
+    this->classifier.reset();
 }
 
 void Region::generateSeedPoints(PointGenerator p, int nX, int nY){
+    PROFILE_PHASE("seed generation");
     BoundingBox box = this->getBox();
     p.generate(this->seedPoints, box, nX, nY);
     this->clean();
 }
 
+void Region::generateSeedPoints(PoissonDiskGenerator generator) {
+    PROFILE_PHASE("seed generation");
+    generator.generate(this->seedPoints, *this);
+    this->clean();
+}
+
 void Region::addSeedPoints(std::vector<Point>& seeds) {
     this->seedPoints.assign(seeds.begin(), seeds.end());
     this->clean();
@@ -129,27 +144,30 @@ BoundingBox Region::getBox() {
     return BoundingBox(Point(xMin,yMin), Point(xMax,yMax));
 }
 
-void Region::clean() {
-    std::vector<int> toKeep;
-    std::vector<Point> newSeeds;
+RegionClassifier& Region::getClassifier() {
+    if(!this->classifier){
+        this->classifier = std::make_shared<RegionClassifier>(this->p, this->holes);
+    }
 
-    for(int i = 0; i<seedPoints.size(); i++){
-        if(Polygon::containsPoint(p,seedPoints[i])){
-            bool keep = true;
+    return *this->classifier;
+}
 
-            for (Hole h : this->holes){
-                keep = keep && !h.containsPoint(seedPoints[i]);
-            }
+void Region::clean() {
+    RegionClassifier& classifier = getClassifier();
+    std::vector<char> keep(seedPoints.size());
 
-            if(keep){
-                toKeep.push_back(i);
-            }
+    delynoi_utilities::parallelFor((int) seedPoints.size(), delynoi_utilities::numberOfThreads(),
+                                   [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            keep[i] = classifier.contains(this->p, this->holes, seedPoints[i]);
         }
+    });
 
-    }
-
-    for(int i=0; i<toKeep.size(); i++){
-        newSeeds.push_back(seedPoints[toKeep[i]]);
+    std::vector<Point> newSeeds;
+    for(int i=0; i<seedPoints.size(); i++){
+        if(keep[i]){
+            newSeeds.push_back(seedPoints[i]);
+        }
     }
 
     this->seedPoints = newSeeds;
@@ -179,15 +197,11 @@ void Region::getSegments(std::vector<IndexSegment> &s) {
 }
 
 bool Region::containsPoint(Point p) {
-    std::vector<Point> regionPoints = this->p;
-
-    return Polygon::containsPoint(regionPoints, p);
+    return Polygon::containsPoint(this->p, p);
 }
 
 bool Region::inEdges(Point p) {
-    std::vector<Point> regionPoints = this->p;
-
-    return Polygon::inEdges(regionPoints, p);
+    return Polygon::inEdges(this->p, p);
 }
 
 void Region::cleanSeedPoints() {
@@ -195,33 +209,44 @@ void Region::cleanSeedPoints() {
 }
 
 void Region::printInFile(std::string fileName) {
+    PROFILE_PHASE("output");
     std::string path = utilities::getPath();
     path +=  fileName;
 
-    std::ofstream file;
-    file.open(path, std::ios::out);
+    BufferedWriter writer(path);
 
     std::vector<Point> points = this->getRegionPoints();
 
-    file << (points.size() + seedPoints.size()) << std::endl;
+    writer.write((int) (points.size() + seedPoints.size()));
+    writer.write('\n');
     for(int i=0;i<points.size();i++){
-        file << points[i].getString() << std::endl;
+        writer.write(points[i].getX());
+        writer.write(' ');
+        writer.write(points[i].getY());
+        writer.write('\n');
     }
 
     for(int i=0;i<seedPoints.size();i++){
-        file << seedPoints[i].getString() << std::endl;
+        writer.write(seedPoints[i].getX());
+        writer.write(' ');
+        writer.write(seedPoints[i].getY());
+        writer.write('\n');
     }
 
     std::vector<IndexSegment> segments;
     this->getSegments(segments);
 
-    file << segments.size() << std::endl;
+    writer.write((int) segments.size());
+    writer.write('\n');
     for(IndexSegment s: segments){
-        file << s.getString() << std::endl;
+        writer.write(s.getFirst());
+        writer.write(' ');
+        writer.write(s.getSecond());
+        writer.write('\n');
     }
 
-    file << 0 << std::endl;
-
-    file.close();
+    writer.write(0);
+    writer.write('\n');
 
+    writer.close();
 }
@@ -0,0 +1,156 @@
+#include <delynoi/models/RegionClassifier.h>
+#include <delynoi/config/DelynoiConfig.h>
+#include <delynoi/utilities/geometryFunctions.h>
+#include <algorithm>
+#include <cmath>
+
+RegionClassifier::RegionClassifier(std::vector<Point> &outline, std::vector<Hole> &holes) : polygon(outline) {
+    double tolerance = DelynoiConfig::instance()->getTolerance();
+
+    // Edges of the outline and the holes, as pairs of points
+    std::vector<std::pair<Point,Point>> outlineEdges;
+    for (int i = 0; i < (int) outline.size(); ++i) {
+        outlineEdges.push_back(std::make_pair(outline[i], outline[(i + 1)%outline.size()]));
+    }
+    std::vector<std::pair<Point,Point>> edges = outlineEdges;
+    for(Hole& h: holes){
+        std::vector<Point> holePoints = h.getPoints();
+        double box[4] = {holePoints[0].getX(), holePoints[0].getY(), holePoints[0].getX(), holePoints[0].getY()};
+
+        for (int i = 0; i < (int) holePoints.size(); ++i) {
+            edges.push_back(std::make_pair(holePoints[i], holePoints[(i + 1)%holePoints.size()]));
+
+            box[0] = std::min(box[0], holePoints[i].getX());
+            box[1] = std::min(box[1], holePoints[i].getY());
+            box[2] = std::max(box[2], holePoints[i].getX());
+            box[3] = std::max(box[3], holePoints[i].getY());
+        }
+
+        this->holeBoxes.insert(this->holeBoxes.end(), {box[0] - tolerance, box[1] - tolerance,
+                                                       box[2] + tolerance, box[3] + tolerance});
+    }
+
+    // Grid over the bounding box of the outline (slightly enlarged, so points on the outline fall inside it), with
+    // about four cells per edge
+    double xMax = outline[0].getX(), yMax = outline[0].getY();
+    this->xMin = xMax;
+    this->yMin = yMax;
+    for(Point& p: outline){
+        this->xMin = std::min(this->xMin, p.getX());
+        this->yMin = std::min(this->yMin, p.getY());
+        xMax = std::max(xMax, p.getX());
+        yMax = std::max(yMax, p.getY());
+    }
+    this->xMin -= 2*tolerance;
+    this->yMin -= 2*tolerance;
+    double width = xMax + 2*tolerance - this->xMin;
+    double height = yMax + 2*tolerance - this->yMin;
+
+    double target = std::max(16.0, std::min(4.0*edges.size(), 4.0e6));
+    this->cellSize = std::sqrt(width*height/target);
+    this->nX = std::max(1, (int) std::ceil(width/this->cellSize));
+    this->nY = std::max(1, (int) std::ceil(height/this->cellSize));
+
+    this->outlineCells = rasterize(outlineEdges, [&](Point p){ return this->polygon.containsPoint(outline, p); });
+    this->cells = rasterize(edges, [&](Point p){ return exactTest(outline, holes, p); });
+}
+
+std::vector<char> RegionClassifier::rasterize(std::vector<std::pair<Point,Point>>& edges,
+                                              std::function<bool(Point)> test) {
+    double tolerance = DelynoiConfig::instance()->getTolerance();
+    std::vector<char> states(this->nX*this->nY, outside);
+
+    std::vector<int> touched;
+    for(std::pair<Point,Point>& e: edges){
+        touched.clear();
+        geometry_functions::segmentCells(e.first, e.second, tolerance, this->xMin, this->yMin, this->cellSize, this->nX,
+                                         this->nY, touched);
+
+        for(int c: touched){
+            states[c] = boundary;
+        }
+    }
+
+    // Cells connected without crossing the boundary are all on the same side: one exact test per component
+    std::vector<bool> visited(states.size(), false);
+    std::vector<int> stack;
+    for (int c = 0; c < (int) states.size(); ++c) {
+        if(visited[c] || states[c]==boundary){
+            continue;
+        }
+
+        Point center(this->xMin + (c%this->nX + 0.5)*this->cellSize, this->yMin + (c/this->nX + 0.5)*this->cellSize);
+        char state = test(center)? inside : outside;
+
+        visited[c] = true;
+        stack.push_back(c);
+        while(!stack.empty()){
+            int d = stack.back();
+            stack.pop_back();
+            states[d] = state;
+
+            int i = d%this->nX, j = d/this->nX;
+            int neighbours[4][2] = {{i - 1, j}, {i + 1, j}, {i, j - 1}, {i, j + 1}};
+            for(int* n: neighbours){
+                if(n[0]<0 || n[0]>=this->nX || n[1]<0 || n[1]>=this->nY){
+                    continue;
+                }
+
+                int e = n[1]*this->nX + n[0];
+                if(!visited[e] && states[e]!=boundary){
+                    visited[e] = true;
+                    stack.push_back(e);
+                }
+            }
+        }
+    }
+
+    return states;
+}
+
+int RegionClassifier::cellX(double x) {
+    return std::max(0, std::min(this->nX - 1, (int) std::floor((x - this->xMin)/this->cellSize)));
+}
+
+int RegionClassifier::cellY(double y) {
+    return std::max(0, std::min(this->nY - 1, (int) std::floor((y - this->yMin)/this->cellSize)));
+}
+
+bool RegionClassifier::exactTest(std::vector<Point> &outline, std::vector<Hole> &holes, Point p) {
+    // The outline is only tested when the point is near it (the outline grid is empty while it is being built)
+    CellState outlineState = this->outlineCells.empty()? boundary :
+                             (CellState) this->outlineCells[cellY(p.getY())*this->nX + cellX(p.getX())];
+    if(outlineState==outside || (outlineState==boundary && !this->polygon.containsPoint(outline, p))){
+        return false;
+    }
+
+    for (int h = 0; h < (int) holes.size(); ++h) {
+        const double* box = &this->holeBoxes[4*h];
+        if(p.getX()<box[0] || p.getY()<box[1] || p.getX()>box[2] || p.getY()>box[3]){
+            continue;
+        }
+
+        if(holes[h].containsPoint(p)){
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool RegionClassifier::contains(std::vector<Point> &outline, std::vector<Hole> &holes, Point p) {
+    double i = std::floor((p.getX() - this->xMin)/this->cellSize);
+    double j = std::floor((p.getY() - this->yMin)/this->cellSize);
+    if(i<0 || j<0 || i>=this->nX || j>=this->nY){
+        return false;
+    }
+
+    switch(this->cells[(int) j*this->nX + (int) i]){
+        case inside:
+            return true;
+        case outside:
+            return false;
+        default:
+            return exactTest(outline, holes, p);
+    }
+}
@@ -14,7 +14,7 @@ Point::Point() {
 }
 
 bool Point::isValid() {
-    return this->isEmpty;
+    return !this->isEmpty;
 }
 
 double Point::getX() const{
@@ -34,10 +34,10 @@ double Point::squareNorm() {
 }
 
 bool Point::operator==(const Point &other) const{
-    DelynoiConfig* config = DelynoiConfig::instance();
+    double tolerance = DelynoiConfig::instance()->getTolerance();
 
-    return std::abs(this->x-other.x)<config->getTolerance() &&
-           std::abs(this->y-other.y)<config->getTolerance();
+    return std::abs(this->x-other.x)<tolerance &&
+           std::abs(this->y-other.y)<tolerance;
 }
 
 
@@ -62,10 +62,10 @@ void Point::setY(double newY) {
 }
 
 bool Point::operator<(const Point &other) const {
-    DelynoiConfig* config = DelynoiConfig::instance();
+    double tolerance = DelynoiConfig::instance()->getTolerance();
 
-    if(std::abs(this->x-other.x)<config->getTolerance()){
-        if(std::abs(this->y-other.y)<config->getTolerance()){
+    if(std::abs(this->x-other.x)<tolerance){
+        if(std::abs(this->y-other.y)<tolerance){
             return false;
         }
         return this->y<other.y;
@@ -0,0 +1,132 @@
+#include <delynoi/models/basic/PointIndex.h>
+#include <delynoi/config/DelynoiConfig.h>
+
+void UniqueIndex<Point>::checkTolerance() {
+    double current = DelynoiConfig::instance()->getTolerance();
+    if(current==this->tolerance){
+        return;
+    }
+
+    this->tolerance = current;
+    this->cellSize = current>0? 4*current : 1;
+
+    this->cells.clear();
+    for (int e = 0; e < entries.size(); ++e) {
+        double offset;
+        long long i = cellCoordinate(entries[e].x, offset), j = cellCoordinate(entries[e].y, offset);
+
+        link(cellKey(i, j), e);
+    }
+}
+
+long long UniqueIndex<Point>::cellCoordinate(double value, double &offset) const {
+    // Limit the coordinate so that it fits a long long (far away cells just share keys)
+    const double limit = 4.0e18;
+    double scaled = value/cellSize;
+
+    if(!(std::abs(scaled) < limit)){
+        offset = 0.5;
+        return scaled<0? (long long) -limit : (long long) limit;
+    }
+
+    double cell = std::floor(scaled);
+    offset = scaled - cell;
+
+    return (long long) cell;
+}
+
+unsigned long long UniqueIndex<Point>::cellKey(long long i, long long j) const {
+    return (unsigned long long) i*0x9E3779B97F4A7C15ULL ^ (unsigned long long) j*0xC2B2AE3D27D4EB4FULL;
+}
+
+void UniqueIndex<Point>::link(unsigned long long key, int entry) {
+    auto found = cells.find(key);
+
+    if(found==cells.end()){
+        entries[entry].next = -1;
+        cells.insert(std::make_pair(key, entry));
+    } else{
+        entries[entry].next = found->second;
+        found->second = entry;
+    }
+}
+
+int UniqueIndex<Point>::lookup(double x, double y, unsigned long long &key) const {
+    double offsetX, offsetY;
+    long long i = cellCoordinate(x, offsetX), j = cellCoordinate(y, offsetY);
+    key = cellKey(i, j);
+
+    // Cells are wider than twice the tolerance, so the equivalent points are in this cell or, when the point is close
+    // to the border (with some margin for rounding errors), in the neighbours on that side
+    double border = tolerance>0? 1.25*tolerance/cellSize : 0;
+    int di = offsetX<border? -1 : (offsetX>1-border? 1 : 0);
+    int dj = offsetY<border? -1 : (offsetY>1-border? 1 : 0);
+
+    unsigned long long keys[4] = {key};
+    int n = 1;
+    if(di!=0){
+        keys[n++] = cellKey(i + di, j);
+    }
+    if(dj!=0){
+        keys[n++] = cellKey(i, j + dj);
+    }
+    if(di!=0 && dj!=0){
+        keys[n++] = cellKey(i + di, j + dj);
+    }
+
+    int result = -1;
+    for (int k = 0; k < n; ++k) {
+        auto found = cells.find(keys[k]);
+        if(found==cells.end()){
+            continue;
+        }
+
+        for (int e = found->second; e >= 0; e = entries[e].next) {
+            const Entry& entry = entries[e];
+            bool equivalent = tolerance>0? std::abs(entry.x-x)<tolerance && std::abs(entry.y-y)<tolerance :
+                              entry.x==x && entry.y==y;
+
+            if(equivalent && (result<0 || entry.index<result)){
+                result = entry.index;
+            }
+        }
+    }
+
+    return result;
+}
+
+int UniqueIndex<Point>::find(const Point &item) {
+    checkTolerance();
+
+    unsigned long long key;
+    return lookup(item.getX(), item.getY(), key);
+}
+
+int UniqueIndex<Point>::findOrInsert(const Point &item, int index) {
+    checkTolerance();
+
+    unsigned long long key;
+    int found = lookup(item.getX(), item.getY(), key);
+
+    if(found<0){
+        entries.push_back(Entry{item.getX(), item.getY(), index, -1});
+        link(key, (int) entries.size() - 1);
+    }
+
+    return found;
+}
+
+void UniqueIndex<Point>::insert(const Point &item, int index) {
+    checkTolerance();
+
+    double offset;
+    long long i = cellCoordinate(item.getX(), offset), j = cellCoordinate(item.getY(), offset);
+
+    entries.push_back(Entry{item.getX(), item.getY(), index, -1});
+    link(cellKey(i, j), (int) entries.size() - 1);
+}
+
+void UniqueIndex<Point>::clear() {
+    this->entries.clear();
+    this->cells.clear();
+}
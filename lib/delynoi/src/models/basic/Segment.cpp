@@ -21,15 +21,15 @@ T Segment<T>::getSecond() const{
 
 template <class T>
 bool Segment<T>::contains(Point point, Point p1, Point p2) {
-    DelynoiConfig* config = DelynoiConfig::instance();
+    double tolerance = DelynoiConfig::instance()->getTolerance();
 
-    bool test1 = ((point.getX()>=p1.getX() || std::abs(point.getX()-p1.getX())<config->getTolerance()) && (point.getX()<=p2.getX() || std::abs(point.getX()-p2.getX())<config->getTolerance())) ||
-                 ((point.getX()>=p2.getX() || std::abs(point.getX()-p2.getX())<config->getTolerance()) && (point.getX()<=p1.getX() || std::abs(point.getX()-p1.getX())<config->getTolerance()));
-    bool test2 =  ((point.getY()>=p1.getY() || std::abs(point.getY()-p1.getY())<config->getTolerance()) && (point.getY()<=p2.getY() || std::abs(point.getY()-p2.getY())<config->getTolerance()) ||
-                  ((point.getY()>=p2.getY() || std::abs(point.getY()-p2.getY())<config->getTolerance()) && (point.getY()<=p1.getY() || std::abs(point.getY()-p1.getY())<config->getTolerance())));
+    bool test1 = ((point.getX()>=p1.getX() || std::abs(point.getX()-p1.getX())<tolerance) && (point.getX()<=p2.getX() || std::abs(point.getX()-p2.getX())<tolerance)) ||
+                 ((point.getX()>=p2.getX() || std::abs(point.getX()-p2.getX())<tolerance) && (point.getX()<=p1.getX() || std::abs(point.getX()-p1.getX())<tolerance));
+    bool test2 =  ((point.getY()>=p1.getY() || std::abs(point.getY()-p1.getY())<tolerance) && (point.getY()<=p2.getY() || std::abs(point.getY()-p2.getY())<tolerance) ||
+                  ((point.getY()>=p2.getY() || std::abs(point.getY()-p2.getY())<tolerance) && (point.getY()<=p1.getY() || std::abs(point.getY()-p1.getY())<tolerance)));
 
     return  test1 &&  test2 &&
-            std::abs(p1.getX()*(p2.getY()-point.getY()) + p2.getX()*(point.getY()-p1.getY()) + point.getX()*(p1.getY()-p2.getY()))<config->getTolerance();
+            std::abs(p1.getX()*(p2.getY()-point.getY()) + p2.getX()*(point.getY()-p1.getY()) + point.getX()*(p1.getY()-p2.getY()))<tolerance;
 }
 
 template <class T>
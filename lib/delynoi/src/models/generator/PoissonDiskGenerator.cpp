@@ -0,0 +1,142 @@
+#include <delynoi/models/generator/PoissonDiskGenerator.h>
+#include <delynoi/models/Region.h>
+#include <cmath>
+#include <random>
+
+PoissonDiskGenerator::PoissonDiskGenerator(SizeFunction *size, unsigned int seed, int attempts) {
+    if(attempts<1){
+        throw std::invalid_argument("At least one candidate must be tried around each point");
+    }
+
+    this->size = size;
+    this->seed = seed;
+    this->attempts = attempts;
+}
+
+void PoissonDiskGenerator::generate(std::vector<Point> &points, Region &region) {
+    BoundingBox box = region.getBox();
+    double cellSize = this->size->getMinimumSize();
+    if(cellSize<=0){
+        throw std::invalid_argument("The minimum of the size function must be positive");
+    }
+
+    int nX = (int) std::ceil(box.getWidth()/cellSize) + 1;
+    int nY = (int) std::ceil(box.getHeight()/cellSize) + 1;
+    if((double) nX*nY > 1e8){
+        throw std::invalid_argument("The minimum of the size function is too small for the region");
+    }
+
+    // Cell of each point, and points whose exclusion disk touches each cell
+    std::vector<std::vector<int>> home(nX*nY);
+    std::vector<std::vector<int>> cover(nX*nY);
+    std::vector<Point> generated;
+    std::vector<double> radius;
+    std::vector<int> active;
+
+    std::mt19937 rng(this->seed);
+    std::uniform_real_distribution<double> uni(0, 1);
+    std::vector<Hole>& holes = region.getHoles();
+
+    auto inside = [&](Point& p){
+        if(!region.containsPoint(p)){
+            return false;
+        }
+        for(Hole& h: holes){
+            if(h.containsPoint(p)){
+                return false;
+            }
+        }
+        return true;
+    };
+
+    auto cellX = [&](double x){
+        return std::max(0, std::min(nX - 1, (int) std::floor((x - box.xMin())/cellSize)));
+    };
+    auto cellY = [&](double y){
+        return std::max(0, std::min(nY - 1, (int) std::floor((y - box.yMin())/cellSize)));
+    };
+    auto distance = [](Point& a, Point& b){
+        return std::hypot(a.getX() - b.getX(), a.getY() - b.getY());
+    };
+
+    auto accept = [&](Point& p, double r){
+        for(int k: cover[cellY(p.getY())*nX + cellX(p.getX())]){
+            if(distance(generated[k], p) < radius[k]){
+                return false;
+            }
+        }
+
+        for (int j = cellY(p.getY() - r); j <= cellY(p.getY() + r); ++j) {
+            for (int i = cellX(p.getX() - r); i <= cellX(p.getX() + r); ++i) {
+                for(int k: home[j*nX + i]){
+                    if(distance(generated[k], p) < r){
+                        return false;
+                    }
+                }
+            }
+        }
+
+        return true;
+    };
+
+    auto add = [&](Point& p, double r){
+        int index = (int) generated.size();
+        generated.push_back(p);
+        radius.push_back(r);
+        active.push_back(index);
+
+        home[cellY(p.getY())*nX + cellX(p.getX())].push_back(index);
+        for (int j = cellY(p.getY() - r); j <= cellY(p.getY() + r); ++j) {
+            for (int i = cellX(p.getX() - r); i <= cellX(p.getX() + r); ++i) {
+                cover[j*nX + i].push_back(index);
+            }
+        }
+    };
+
+    while(true){
+        // Start (and, when no point can be added around the existing ones, restart) from random points, so parts of
+        // the domain that the growth could not reach are also filled
+        if(active.empty()){
+            bool found = false;
+            for (int t = 0; t < 10*this->attempts && !found; ++t) {
+                Point p(box.xMin() + uni(rng)*box.getWidth(), box.yMin() + uni(rng)*box.getHeight());
+                if(inside(p)){
+                    double r = this->size->apply(p);
+                    if(accept(p, r)){
+                        add(p, r);
+                        found = true;
+                    }
+                }
+            }
+
+            if(!found){
+                break;
+            }
+        }
+
+        int a = std::min((int) active.size() - 1, (int) (uni(rng)*active.size()));
+        int k = active[a];
+        bool found = false;
+
+        for (int t = 0; t < this->attempts && !found; ++t) {
+            double angle = 2*M_PI*uni(rng);
+            double d = radius[k]*(1 + uni(rng));
+            Point q(generated[k].getX() + d*std::cos(angle), generated[k].getY() + d*std::sin(angle));
+
+            if(inside(q)){
+                double r = this->size->apply(q);
+                if(accept(q, r)){
+                    add(q, r);
+                    found = true;
+                }
+            }
+        }
+
+        if(!found){
+            active[a] = active.back();
+            active.pop_back();
+        }
+    }
+
+    points.insert(points.end(), generated.begin(), generated.end());
+}
@@ -0,0 +1,150 @@
+#include <delynoi/models/generator/size/DistanceSizeFunction.h>
+#include <delynoi/utilities/geometryFunctions.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    double distance(PointSegment& segment, Point p){
+        Point a = segment.getFirst();
+        Point b = segment.getSecond();
+        double dx = b.getX() - a.getX(), dy = b.getY() - a.getY();
+        double length2 = dx*dx + dy*dy;
+
+        double t = length2>0? ((p.getX() - a.getX())*dx + (p.getY() - a.getY())*dy)/length2 : 0;
+        t = std::max(0.0, std::min(1.0, t));
+
+        return std::hypot(a.getX() + t*dx - p.getX(), a.getY() + t*dy - p.getY());
+    }
+}
+
+DistanceSizeFunction::DistanceSizeFunction(double minSize, double maxSize, double gradient) {
+    if(minSize<=0 || maxSize<minSize || gradient<0){
+        throw std::invalid_argument("Sizes must be positive, with the maximum not below the minimum, and the gradient "
+                                            "can not be negative");
+    }
+
+    this->minSize = minSize;
+    this->maxSize = maxSize;
+    this->gradient = gradient;
+    this->gridBuilt = false;
+}
+
+void DistanceSizeFunction::addHole(Hole &hole) {
+    std::vector<Point> points = hole.getPoints();
+    int n = (int) points.size();
+
+    for (int i = 0; i < n; ++i) {
+        this->features.push_back(PointSegment(points[i], points[(i + 1)%n]));
+    }
+
+    this->gridBuilt = false;
+}
+
+void DistanceSizeFunction::addSegment(PointSegment segment) {
+    this->features.push_back(segment);
+    this->gridBuilt = false;
+}
+
+void DistanceSizeFunction::addPoint(Point p) {
+    this->features.push_back(PointSegment(p, p));
+    this->gridBuilt = false;
+}
+
+void DistanceSizeFunction::buildGrid() {
+    this->xMin = this->xMax = this->features[0].getFirst().getX();
+    this->yMin = this->yMax = this->features[0].getFirst().getY();
+    for(PointSegment& segment: this->features){
+        for(Point q: {segment.getFirst(), segment.getSecond()}){
+            this->xMin = std::min(this->xMin, q.getX());
+            this->yMin = std::min(this->yMin, q.getY());
+            this->xMax = std::max(this->xMax, q.getX());
+            this->yMax = std::max(this->yMax, q.getY());
+        }
+    }
+
+    int n = (int) this->features.size();
+    double width = this->xMax - this->xMin, height = this->yMax - this->yMin;
+    this->cellSize = std::max(std::sqrt(width*height/n), std::max(width, height)/n);
+    if(this->cellSize<=0){
+        this->cellSize = 1;
+    }
+    this->nX = (int) (width/this->cellSize) + 1;
+    this->nY = (int) (height/this->cellSize) + 1;
+
+    // Cells of each feature, then grouped by cell (features of each cell in increasing order)
+    std::vector<int> cells, owners;
+    for (int k = 0; k < n; ++k) {
+        geometry_functions::segmentCells(this->features[k].getFirst(), this->features[k].getSecond(), 0, this->xMin,
+                                         this->yMin, this->cellSize, this->nX, this->nY, cells);
+        owners.resize(cells.size(), k);
+    }
+
+    this->cellOffsets.assign(this->nX*this->nY + 1, 0);
+    for(int c: cells){
+        this->cellOffsets[c + 1]++;
+    }
+    for (int c = 0; c < this->nX*this->nY; ++c) {
+        this->cellOffsets[c + 1] += this->cellOffsets[c];
+    }
+
+    this->cellFeatures.resize(cells.size());
+    std::vector<int> next(this->cellOffsets.begin(), this->cellOffsets.end() - 1);
+    for (int k = 0; k < (int) cells.size(); ++k) {
+        this->cellFeatures[next[cells[k]]++] = owners[k];
+    }
+
+    this->gridBuilt = true;
+}
+
+double DistanceSizeFunction::apply(Point p) {
+    if(this->features.empty()){
+        return this->maxSize;
+    }
+    if(!this->gridBuilt){
+        buildGrid();
+    }
+
+    // Features farther than the cutoff do not change the size
+    double cutoff = this->gradient>0? (this->maxSize - this->minSize)/this->gradient :
+                    std::numeric_limits<double>::infinity();
+    double outside = std::hypot(std::max(0.0, std::max(this->xMin - p.getX(), p.getX() - this->xMax)),
+                                std::max(0.0, std::max(this->yMin - p.getY(), p.getY() - this->yMax)));
+    if(outside>=cutoff){
+        return this->maxSize;
+    }
+
+    int ci = std::max(0, std::min(this->nX - 1, (int) std::floor((p.getX() - this->xMin)/this->cellSize)));
+    int cj = std::max(0, std::min(this->nY - 1, (int) std::floor((p.getY() - this->yMin)/this->cellSize)));
+
+    // Rings of cells around the cell of p: the cells of ring r are at least (r - 1)*cellSize away from p
+    double d = std::numeric_limits<double>::infinity();
+    for (int r = 0; r < std::max(this->nX, this->nY); ++r) {
+        double bound = std::max(outside, (r - 1)*this->cellSize);
+        if(r>0 && (bound>=d || bound>=cutoff)){
+            break;
+        }
+
+        for (int j = std::max(0, cj - r); j <= std::min(this->nY - 1, cj + r); ++j) {
+            int step = (j==cj - r || j==cj + r)? 1 : 2*r;
+
+            for (int i = ci - r; i <= ci + r; i += step) {
+                if(i<0 || i>=this->nX){
+                    continue;
+                }
+
+                int c = j*this->nX + i;
+                for (int k = this->cellOffsets[c]; k < this->cellOffsets[c + 1]; ++k) {
+                    d = std::min(d, distance(this->features[this->cellFeatures[k]], p));
+                }
+            }
+        }
+    }
+
+    return std::min(this->maxSize, this->minSize + this->gradient*d);
+}
+
+double DistanceSizeFunction::getMinimumSize() {
+    return this->minSize;
+}
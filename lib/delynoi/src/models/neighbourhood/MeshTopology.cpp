@@ -0,0 +1,112 @@
+#include <delynoi/models/neighbourhood/MeshTopology.h>
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+MeshTopology::MeshTopology() {
+    this->numberOfVertices = 0;
+    this->cellOffsets.push_back(0);
+    this->vertexOffsets.push_back(0);
+}
+
+MeshTopology::MeshTopology(int numberOfVertices, const std::vector<int> &cellOffsets,
+                           const std::vector<int> &cellVertices) {
+    if(cellOffsets.empty() || cellOffsets.back()!=cellVertices.size()){
+        throw std::invalid_argument("Cell offsets do not match the number of cell vertices");
+    }
+
+    this->numberOfVertices = numberOfVertices;
+    this->cellOffsets = cellOffsets;
+    this->halfEdgeOrigin = cellVertices;
+
+    int cells = (int) cellOffsets.size() - 1;
+    int halfEdges = (int) cellVertices.size();
+
+    this->halfEdgeCell.resize(halfEdges);
+    for (int c = 0; c < cells; ++c) {
+        std::fill(halfEdgeCell.begin() + cellOffsets[c], halfEdgeCell.begin() + cellOffsets[c + 1], c);
+    }
+
+    for(int v: cellVertices){
+        if(v<0 || v>=numberOfVertices){
+            throw std::invalid_argument("Cell vertex index out of range");
+        }
+    }
+
+    // Sort the half-edges by their (unordered) endpoints, so that the two sides of each edge end up together
+    std::vector<std::pair<uint64_t,int>> keys(halfEdges);
+    for (int h = 0; h < halfEdges; ++h) {
+        uint64_t a = (uint64_t) origin(h);
+        uint64_t b = (uint64_t) target(h);
+        keys[h] = std::make_pair(a<b? (a<<32)|b : (b<<32)|a, h);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    this->halfEdgeTwin.assign(halfEdges, -1);
+    this->halfEdgeEdge.resize(halfEdges);
+
+    for (int i = 0; i < halfEdges;) {
+        int j = i + 1;
+        while(j < halfEdges && keys[j].first==keys[i].first){
+            j++;
+        }
+
+        // Edges shared by more than two cells (non manifold meshes) only link the first two
+        if(j - i >= 2){
+            halfEdgeTwin[keys[i].second] = keys[i + 1].second;
+            halfEdgeTwin[keys[i + 1].second] = keys[i].second;
+        }else{
+            boundaryEdges.push_back((int) edgeHalfEdge.size());
+        }
+
+        for (int k = i; k < j; ++k) {
+            halfEdgeEdge[keys[k].second] = (int) edgeHalfEdge.size();
+        }
+        edgeHalfEdge.push_back(keys[i].second);
+
+        i = j;
+    }
+
+    // Vertex stars, by counting sort of the half-edges by origin (keeps them in increasing cell order)
+    this->vertexOffsets.assign(numberOfVertices + 1, 0);
+    for(int v: cellVertices){
+        vertexOffsets[v + 1]++;
+    }
+    for (int v = 0; v < numberOfVertices; ++v) {
+        vertexOffsets[v + 1] += vertexOffsets[v];
+    }
+
+    this->vertexHalfEdges.resize(halfEdges);
+    this->vertexCells.resize(halfEdges);
+    std::vector<int> position(vertexOffsets.begin(), vertexOffsets.end() - 1);
+
+    for (int h = 0; h < halfEdges; ++h) {
+        int p = position[halfEdgeOrigin[h]]++;
+        vertexHalfEdges[p] = h;
+        vertexCells[p] = halfEdgeCell[h];
+    }
+}
+
+int MeshTopology::findEdge(int a, int b) const {
+    for(int h: outgoingHalfEdges(a)){
+        if(target(h)==b){
+            return halfEdgeEdge[h];
+        }
+    }
+
+    for(int h: outgoingHalfEdges(b)){
+        if(target(h)==a){
+            return halfEdgeEdge[h];
+        }
+    }
+
+    return -1;
+}
+
+size_t MeshTopology::memoryUsage() const {
+    size_t ints = cellOffsets.size() + halfEdgeOrigin.size() + halfEdgeCell.size() + halfEdgeTwin.size() +
+                  halfEdgeEdge.size() + edgeHalfEdge.size() + boundaryEdges.size() + vertexOffsets.size() +
+                  vertexHalfEdges.size() + vertexCells.size();
+
+    return ints*sizeof(int) + sizeof(MeshTopology);
+}
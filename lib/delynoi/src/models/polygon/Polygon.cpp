@@ -3,15 +3,19 @@
 #include <utilities/UniqueList.h>
 #include <utilities/Pair.h>
 #include <delynoi/models/neighbourhood/SegmentMap.h>
+#include <functional>
+#include <set>
 
 
-Polygon::Polygon(std::vector<int>& points, std::vector<Point>& p) {
-    if(isSelfIntersecting(p)){
-        throw std::invalid_argument("Self intersecting polygons are not supported");
-    }
+Polygon::Polygon(std::vector<int>& points, std::vector<Point>& p) : Polygon(points, p, true) {}
 
+Polygon::Polygon(std::vector<int>& points, std::vector<Point>& p, bool validate) {
     this->points.assign(points.begin(), points.end());
 
+    if(validate && isSelfIntersecting(p)){
+        throw std::invalid_argument("Self intersecting polygons are not supported");
+    }
+
     this->diameter = -1;
     this->area = -1;
     this->centroid = Point();
@@ -32,6 +36,14 @@ void Polygon::mutate(std::vector<Point> &p) {
     calculateHash();
 }
 
+void Polygon::renumberPoints(const std::vector<int> &newIndexes) {
+    for(int& point: this->points){
+        point = newIndexes[point];
+    }
+
+    calculateHash();
+}
+
 Polygon::Polygon(std::vector<Point> &p) {
     if(isSelfIntersecting(p)){
         std::invalid_argument("Self intersecting polygons are not supported");
@@ -289,24 +301,122 @@ bool Polygon::operator<(const Polygon &other) const {
 }
 
 bool Polygon::isSelfIntersecting(std::vector<Point>& points) {
+    int n = this->points.size();
+    if(n<4){
+        return false;
+    }
+
+    // Sides oriented from their leftmost (lowest, if vertical) endpoint
+    std::vector<std::pair<Point,Point>> sides(n);
+    for (int i = 0; i < n; ++i) {
+        Point a = points[this->points[i]], b = points[this->points[(i + 1)%n]];
+        bool leftFirst = a.getX()<b.getX() || (a.getX()==b.getX() && a.getY()<=b.getY());
+        sides[i] = leftFirst? std::make_pair(a, b) : std::make_pair(b, a);
+    }
+
+    auto cross = [](const Point& o, const Point& a, const Point& b){
+        return (a.getX() - o.getX())*(b.getY() - o.getY()) - (a.getY() - o.getY())*(b.getX() - o.getX());
+    };
+    auto leftOf = [](const Point& a, const Point& b){
+        return a.getX()<b.getX() || (a.getX()==b.getX() && a.getY()<b.getY());
+    };
+
+    // Order of the sides in the sweep line (from below): the side that starts later is compared against the other one
+    // at its starting point, which is valid while the sides in the sweep line do not cross. Collinear sides can not be
+    // ordered, so they are marked as a degenerate case
+    bool degenerate = false;
+    auto below = [&](int i, int j){
+        if(i==j){
+            return false;
+        }
+
+        bool swap = leftOf(sides[j].first, sides[i].first);
+        const std::pair<Point,Point>& first = sides[swap? j : i];
+        const std::pair<Point,Point>& second = sides[swap? i : j];
+
+        double o = cross(first.first, first.second, second.first);
+        if(o==0){
+            o = cross(first.first, first.second, second.second);
+        }
+        if(o==0){
+            degenerate = true;
+            return i<j;
+        }
+
+        return swap? o<0 : o>0;
+    };
+
+    // Events: each side enters the sweep line at its first endpoint and leaves it at the second one, with entries
+    // before exits at the same point
+    std::vector<std::pair<int,bool>> events;
+    events.reserve(2*n);
+    for (int i = 0; i < n; ++i) {
+        events.push_back(std::make_pair(i, true));
+        events.push_back(std::make_pair(i, false));
+    }
+    std::sort(events.begin(), events.end(), [&](const std::pair<int,bool>& e1, const std::pair<int,bool>& e2){
+        const Point& p1 = e1.second? sides[e1.first].first : sides[e1.first].second;
+        const Point& p2 = e2.second? sides[e2.first].first : sides[e2.first].second;
+        if(leftOf(p1, p2) || leftOf(p2, p1)){
+            return leftOf(p1, p2);
+        }
+        return e1.second && !e2.second;
+    });
+
+    // A point shared by more than two sides (a repeated vertex) is also degenerate
+    for (int e = 2; e < events.size() && !degenerate; ++e) {
+        const Point& p0 = events[e - 2].second? sides[events[e - 2].first].first : sides[events[e - 2].first].second;
+        const Point& p2 = events[e].second? sides[events[e].first].first : sides[events[e].first].second;
+        degenerate = !leftOf(p0, p2) && !leftOf(p2, p0);
+    }
+
     std::vector<IndexSegment> segments;
     this->getSegments(segments);
-    int n = segments.size();
     Point intersection;
+    auto intersects = [&](int i, int j){
+        if(j==(i-1+n)%n || j==(i+1)%n){
+            return false;
+        }
+        return segments[i].intersection(points, segments[j], intersection);
+    };
 
-    for (int i = 0; i < n; ++i) {
-        IndexSegment s = segments[i];
+    typedef std::set<int, std::function<bool(int,int)>> SweepLine;
+    SweepLine sweep(below);
+    std::vector<SweepLine::iterator> position(n);
+    for(std::pair<int,bool>& e: events){
+        int i = e.first;
 
-        for (int j = 0; j < n; ++j) {
-            if(i==j || j==(i-1+n)%n || j==(i+1)%n){
-                continue;
-            }
+        if(e.second){
+            auto it = sweep.insert(i).first;
+            position[i] = it;
 
-            if(s.intersection(points,segments[j],intersection)){
+            if(it!=sweep.begin() && intersects(i, *std::prev(it))){
+                return true;
+            }
+            if(std::next(it)!=sweep.end() && intersects(i, *std::next(it))){
                 return true;
             }
+        } else{
+            auto it = position[i];
+            if(it!=sweep.begin() && std::next(it)!=sweep.end() && intersects(*std::prev(it), *std::next(it))){
+                return true;
+            }
+
+            sweep.erase(it);
         }
     }
+
+    // The sweep finds all intersections of sides in general position; degenerate polygons are tested pair by pair
+    if(degenerate){
+        for (int i = 0; i < n; ++i) {
+            for (int j = i + 1; j < n; ++j) {
+                if(intersects(i, j)){
+                    return true;
+                }
+            }
+        }
+    }
+
     return false;
 }
 
@@ -3,16 +3,16 @@
 
 Triangle::Triangle() {}
 
-Triangle::Triangle(std::vector<int> points, std::vector<Point>& p) : Polygon(points, p) {
+Triangle::Triangle(std::vector<int> points, std::vector<Point>& p) : Polygon(points, p, false) {
     this->circumcenter = this->calculateCircumcenter(p);
 }
 
-Triangle::Triangle(std::vector<int> points, std::vector<Point>& p, UniqueList<Point>& circumcenters) : Polygon(points, p) {
+Triangle::Triangle(std::vector<int> points, std::vector<Point>& p, UniqueList<Point>& circumcenters) : Polygon(points, p, false) {
     this->circumcenter = this->calculateCircumcenter(p);
     this->circumcenterIndex = circumcenters.push_back(this->circumcenter);
 }
 
-Triangle::Triangle(std::vector<int> points, std::vector<Point> &p, std::vector<Point> &circumcenters) : Polygon(points, p){
+Triangle::Triangle(std::vector<int> points, std::vector<Point> &p, std::vector<Point> &circumcenters) : Polygon(points, p, false){
     this->circumcenter = this->calculateCircumcenter(p);
     this->circumcenterIndex = circumcenters.size();
     circumcenters.push_back(this->circumcenter);
@@ -27,16 +27,7 @@ int Triangle::getCircumcenterIndex() {
 }
 
 Point Triangle::calculateCircumcenter(std::vector<Point>& p){
-    Point A = p[this->points[0]];
-    Point B = p[this->points[1]];
-    Point C = p[this->points[2]];
-
-    double d = 2*(A.getX()*(B.getY() - C.getY()) + B.getX()*(C.getY() - A.getY()) + C.getX()*(A.getY() - B.getY()));
-
-    double uX = (A.squareNorm()*(B.getY() - C.getY()) + B.squareNorm()*(C.getY() - A.getY()) + C.squareNorm()*(A.getY() - B.getY()))/d;
-    double uY = (A.squareNorm()*(C.getX() - B.getX()) + B.squareNorm()*(A.getX() - C.getX()) + C.squareNorm()*(B.getX() - A.getX()))/d;
-
-    return Point(uX,uY);
+    return geometry_functions::circumcenter(p[this->points[0]], p[this->points[1]], p[this->points[2]]);
 }
 
 int Triangle::nextEdge(int center, EdgeData edge, std::unordered_map<Key, int, KeyHasher>& edgeMap) {
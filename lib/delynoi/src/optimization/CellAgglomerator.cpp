@@ -0,0 +1,219 @@
+#include <delynoi/optimization/CellAgglomerator.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <unordered_map>
+
+namespace {
+    int find(std::vector<int>& roots, int c){
+        while(roots[c]!=c){
+            roots[c] = roots[roots[c]];
+            c = roots[c];
+        }
+
+        return c;
+    }
+
+    /* Joins two counterclockwise boundaries, removing the edges they share
+     * @param a first boundary (the joined one starts from one of its vertices)
+     * @param b second boundary
+     * @return boundary of the union, empty if it is not a simple polygon (or the boundaries share no edge)
+     */
+    std::vector<int> join(std::vector<int>& a, std::vector<int>& b){
+        std::vector<std::pair<int,int>> edges;
+        for(std::vector<int>* boundary: {&a, &b}){
+            int n = (int) boundary->size();
+            for (int i = 0; i < n; ++i) {
+                edges.push_back(std::make_pair((*boundary)[i], (*boundary)[(i + 1)%n]));
+            }
+        }
+
+        std::vector<std::pair<int,int>> sorted = edges;
+        std::sort(sorted.begin(), sorted.end());
+
+        // Every vertex of a simple polygon starts a single edge
+        std::unordered_map<int,int> next;
+        int start = -1;
+        for(std::pair<int,int>& e: edges){
+            if(std::binary_search(sorted.begin(), sorted.end(), std::make_pair(e.second, e.first))){
+                continue;
+            }
+            if(next.count(e.first)){
+                return std::vector<int>();
+            }
+
+            next[e.first] = e.second;
+            start = start<0? e.first : start;
+        }
+
+        if(start<0 || next.size()==edges.size()){
+            return std::vector<int>();
+        }
+
+        // The remaining edges must form a single loop
+        std::vector<int> joined;
+        int v = start;
+        do{
+            joined.push_back(v);
+            auto got = next.find(v);
+            if(got==next.end() || joined.size()>next.size()){
+                return std::vector<int>();
+            }
+            v = got->second;
+        }while(v!=start);
+
+        return joined.size()==next.size()? joined : std::vector<int>();
+    }
+}
+
+CellAgglomerator::CellAgglomerator() {}
+
+Mesh<Polygon> CellAgglomerator::agglomerate(Mesh<Polygon> &mesh, int targetCells) {
+    std::vector<bool> marked(mesh.getPolygons().size(), true);
+    return merge(mesh, marked, (int) marked.size(), targetCells);
+}
+
+Mesh<Polygon> CellAgglomerator::agglomerate(Mesh<Polygon> &mesh, std::vector<bool> &marked, int cellsPerAggregate) {
+    if(marked.size()!=mesh.getPolygons().size()){
+        throw std::invalid_argument("The indicator must have one value per cell of the mesh");
+    }
+
+    return merge(mesh, marked, cellsPerAggregate, 0);
+}
+
+Mesh<Polygon> CellAgglomerator::merge(Mesh<Polygon> &mesh, std::vector<bool> &marked, int maxCells, int targetCells) {
+    PROFILE_PHASE("agglomeration");
+
+    std::vector<Point>& points = mesh.getPoints().getList();
+    std::vector<Polygon>& polygons = mesh.getPolygons();
+    SegmentMap* segments = mesh.getSegments();
+    int n = (int) polygons.size();
+
+    // Aggregates are identified by one of their cells (the root); only roots have a boundary
+    std::vector<int> roots(n);
+    std::iota(roots.begin(), roots.end(), 0);
+    std::vector<int> members(n, 1);
+    std::vector<double> areas(n);
+    std::vector<std::vector<int>> boundaries(n);
+
+    typedef std::pair<double,int> Entry;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    for (int c = 0; c < n; ++c) {
+        boundaries[c] = polygons[c].getPoints();
+        areas[c] = polygons[c].getArea(points);
+
+        if(marked[c]){
+            queue.push(std::make_pair(areas[c], c));
+        }
+    }
+
+    int cells = n;
+    while(cells > targetCells && !queue.empty()){
+        Entry entry = queue.top();
+        queue.pop();
+
+        int x = entry.second;
+        if(roots[x]!=x || entry.first!=areas[x]){
+            continue;
+        }
+
+        // Length of the boundary shared with each neighbour that can be merged
+        std::vector<int>& boundary = boundaries[x];
+        std::unordered_map<int,double> shared;
+        for (int i = 0; i < boundary.size(); ++i) {
+            int a = boundary[i], b = boundary[(i + 1)%boundary.size()];
+            NeighboursBySegment& neighbours = segments->get(IndexSegment(a, b));
+            if(neighbours.getFirst()<0 || neighbours.getSecond()<0){
+                continue;
+            }
+
+            int y = find(roots, neighbours.getFirst());
+            y = y!=x? y : find(roots, neighbours.getSecond());
+            if(y==x || !marked[y] || members[x] + members[y] > maxCells){
+                continue;
+            }
+
+            shared[y] += std::hypot(points[a].getX() - points[b].getX(), points[a].getY() - points[b].getY());
+        }
+
+        std::vector<std::pair<double,int>> candidates;
+        for(auto& s: shared){
+            candidates.push_back(std::make_pair(-s.second, s.first));
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        for(std::pair<double,int>& candidate: candidates){
+            int y = candidate.second;
+            std::vector<int> joined = join(boundary, boundaries[y]);
+            if(joined.empty()){
+                continue;
+            }
+
+            roots[y] = x;
+            members[x] += members[y];
+            areas[x] += areas[y];
+            boundaries[x] = joined;
+            boundaries[y].clear();
+            cells--;
+
+            queue.push(std::make_pair(areas[x], x));
+            break;
+        }
+    }
+
+    // Keep the points still used, in the same order, and create the coarse cells
+    std::vector<int> newIndex(points.size(), -1);
+    for (int c = 0; c < n; ++c) {
+        for(int v: boundaries[c]){
+            newIndex[v] = 0;
+        }
+    }
+
+    UniqueList<Point> newPoints;
+    for (int i = 0; i < points.size(); ++i) {
+        if(newIndex[i]==0){
+            newIndex[i] = newPoints.force_push_back(points[i]);
+        }
+    }
+
+    SegmentMap* newSegments = new SegmentMap;
+    PointMap* pointMap = new PointMap;
+    std::vector<Polygon> coarsePolygons;
+    std::vector<int> coarseIndex(n, -1);
+    for (int c = 0; c < n; ++c) {
+        if(roots[c]!=c){
+            continue;
+        }
+
+        int index = (int) coarsePolygons.size();
+        coarseIndex[c] = index;
+
+        std::vector<int> cell;
+        for(int v: boundaries[c]){
+            cell.push_back(newIndex[v]);
+            pointMap->insert(newPoints[newIndex[v]], index);
+        }
+
+        Polygon polygon(cell, newPoints.getList(), false);
+        std::vector<IndexSegment> polygonSegments;
+        polygon.getSegments(polygonSegments);
+        for(IndexSegment& s: polygonSegments){
+            newSegments->insert(s, index);
+        }
+
+        coarsePolygons.push_back(polygon);
+    }
+
+    this->parents.assign(n, -1);
+    for (int c = 0; c < n; ++c) {
+        this->parents[c] = coarseIndex[find(roots, c)];
+    }
+
+    return Mesh<Polygon>(newPoints, coarsePolygons, newSegments, pointMap);
+}
+
+std::vector<int>& CellAgglomerator::getParents() {
+    return this->parents;
+}
@@ -0,0 +1,281 @@
+#include <delynoi/optimization/ShortEdgeCollapser.h>
+#include <delynoi/config/DelynoiConfig.h>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    /*
+     * Twice the signed area of the triangle abc (positive if counterclockwise)
+     */
+    double cross(const Point& a, const Point& b, const Point& c){
+        return (b.getX() - a.getX())*(c.getY() - a.getY()) - (b.getY() - a.getY())*(c.getX() - a.getX());
+    }
+
+    double length(const Point& a, const Point& b){
+        return std::hypot(a.getX() - b.getX(), a.getY() - b.getY());
+    }
+
+    double diameter(std::vector<Point>& points, std::vector<int>& cell){
+        double d = 0;
+        for (int i = 0; i < cell.size(); ++i) {
+            for (int j = i + 1; j < cell.size(); ++j) {
+                d = std::max(d, length(points[cell[i]], points[cell[j]]));
+            }
+        }
+
+        return d;
+    }
+
+    /*
+     * Checks that every vertex of a cell turns left (collinear vertices are accepted)
+     */
+    bool isConvex(std::vector<Point>& points, std::vector<int>& cell){
+        double tolerance = DelynoiConfig::instance()->getTolerance();
+        int n = (int) cell.size();
+
+        for (int i = 0; i < n; ++i) {
+            Point& a = points[cell[(i + n - 1)%n]];
+            Point& b = points[cell[i]];
+            Point& c = points[cell[(i + 1)%n]];
+
+            if(cross(a, b, c) < -tolerance*length(a, b)*length(b, c)){
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /*
+     * Checks that the centroid of a cell sees all its edges from their inner side
+     */
+    bool isStarShaped(std::vector<Point>& points, std::vector<int>& cell){
+        int n = (int) cell.size();
+        double area = 0, x = 0, y = 0;
+
+        for (int i = 0; i < n; ++i) {
+            Point& a = points[cell[i]];
+            Point& b = points[cell[(i + 1)%n]];
+            double c = a.getX()*b.getY() - b.getX()*a.getY();
+
+            area += c;
+            x += (a.getX() + b.getX())*c;
+            y += (a.getY() + b.getY())*c;
+        }
+
+        if(area <= 0){
+            return false;
+        }
+
+        Point centroid(x/(3*area), y/(3*area));
+        for (int i = 0; i < n; ++i) {
+            if(cross(points[cell[i]], points[cell[(i + 1)%n]], centroid) <= 0){
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /*
+     * Vertices joined to v by an edge
+     */
+    std::vector<int> adjacentVertices(MeshTopology& topology, int v){
+        std::vector<int> adjacent;
+        for(int h: topology.outgoingHalfEdges(v)){
+            adjacent.push_back(topology.target(h));
+            adjacent.push_back(topology.origin(topology.previous(h)));
+        }
+
+        std::sort(adjacent.begin(), adjacent.end());
+        adjacent.erase(std::unique(adjacent.begin(), adjacent.end()), adjacent.end());
+        return adjacent;
+    }
+}
+
+ShortEdgeCollapser::ShortEdgeCollapser(double ratio) {
+    if(ratio<0 || ratio>=1){
+        throw std::invalid_argument("The ratio of the collapsed edges must be between 0 and 1");
+    }
+
+    this->ratio = ratio;
+}
+
+Mesh<Polygon> ShortEdgeCollapser::collapse(Mesh<Polygon> &mesh, const std::vector<int> &constrainedPoints) {
+    PROFILE_PHASE("edge collapse");
+
+    std::vector<Point> points = mesh.getPoints().getList();
+    std::vector<std::vector<int>> cells;
+    for(Polygon& polygon: mesh.getPolygons()){
+        cells.push_back(polygon.getPoints());
+    }
+
+    // Boundary vertices stay on the boundary (they never move, and interior ones are only merged into them)
+    std::vector<bool> fixed(points.size(), false);
+    MeshTopology& initialTopology = mesh.getTopology();
+    for(int e: initialTopology.getBoundaryEdges()){
+        IndexSegment edge = initialTopology.getEdge(e);
+        fixed[edge.getFirst()] = true;
+        fixed[edge.getSecond()] = true;
+    }
+    for(int v: constrainedPoints){
+        fixed[v] = true;
+    }
+
+    std::vector<bool> removed(points.size(), false);
+    std::vector<double> diameters(cells.size(), -1);
+    int collapsed;
+
+    do{
+        collapsed = 0;
+
+        std::vector<int> cellOffsets(1, 0);
+        std::vector<int> cellVertices;
+        for(std::vector<int>& cell: cells){
+            cellVertices.insert(cellVertices.end(), cell.begin(), cell.end());
+            cellOffsets.push_back((int) cellVertices.size());
+        }
+        MeshTopology topology((int) points.size(), cellOffsets, cellVertices);
+
+        // Short edges, from the shortest one
+        std::vector<std::pair<double,int>> candidates;
+        for (int e = 0; e < topology.getNumberOfEdges(); ++e) {
+            IndexSegment edge = topology.getEdge(e);
+            if(fixed[edge.getFirst()] && fixed[edge.getSecond()]){
+                continue;
+            }
+
+            double cellDiameter = -1;
+            std::pair<int,int> edgeCells = topology.edgeCells(e);
+            for(int c: {edgeCells.first, edgeCells.second}){
+                if(c<0){
+                    continue;
+                }
+                if(diameters[c]<0){
+                    diameters[c] = diameter(points, cells[c]);
+                }
+                cellDiameter = cellDiameter<0? diameters[c] : std::min(cellDiameter, diameters[c]);
+            }
+
+            double edgeLength = length(points[edge.getFirst()], points[edge.getSecond()]);
+            if(edgeLength < this->ratio*cellDiameter){
+                candidates.push_back(std::make_pair(edgeLength, e));
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        std::vector<bool> locked(cells.size(), false);
+        for(std::pair<double,int>& candidate: candidates){
+            IndexSegment edge = topology.getEdge(candidate.second);
+            int keep = fixed[edge.getSecond()]? edge.getSecond() : edge.getFirst();
+            int gone = keep==edge.getFirst()? edge.getSecond() : edge.getFirst();
+
+            std::vector<int> star;
+            for(int v: {keep, gone}){
+                star.insert(star.end(), topology.vertexStar(v).begin(), topology.vertexStar(v).end());
+            }
+            std::sort(star.begin(), star.end());
+            star.erase(std::unique(star.begin(), star.end()), star.end());
+
+            bool valid = std::none_of(star.begin(), star.end(), [&](int c){ return locked[c]; });
+
+            std::vector<int> keepAdjacent = adjacentVertices(topology, keep);
+            std::vector<int> goneAdjacent = adjacentVertices(topology, gone);
+            std::vector<int> common;
+            std::set_intersection(keepAdjacent.begin(), keepAdjacent.end(), goneAdjacent.begin(), goneAdjacent.end(),
+                                  std::back_inserter(common));
+            valid = valid && common.empty();
+
+            if(!valid){
+                continue;
+            }
+
+            std::vector<bool> wasConvex;
+            for(int c: star){
+                wasConvex.push_back(isConvex(points, cells[c]));
+            }
+
+            // Try the merged vertex, restoring the old position if any cell is invalid
+            Point oldPosition = points[keep];
+            if(!fixed[keep]){
+                points[keep] = Point((points[keep].getX() + points[gone].getX())/2,
+                                     (points[keep].getY() + points[gone].getY())/2);
+            }
+
+            std::vector<std::vector<int>> newCells;
+            for (int i = 0; i < star.size() && valid; ++i) {
+                std::vector<int> cell;
+                for(int v: cells[star[i]]){
+                    int w = v==gone? keep : v;
+                    if(cell.empty() || cell.back()!=w){
+                        cell.push_back(w);
+                    }
+                }
+                if(cell.size()>1 && cell.front()==cell.back()){
+                    cell.pop_back();
+                }
+
+                valid = cell.size()>=3 && (!wasConvex[i] || isConvex(points, cell)) && isStarShaped(points, cell);
+                newCells.push_back(cell);
+            }
+
+            if(!valid){
+                points[keep] = oldPosition;
+                continue;
+            }
+
+            for (int i = 0; i < star.size(); ++i) {
+                cells[star[i]] = newCells[i];
+                diameters[star[i]] = -1;
+                locked[star[i]] = true;
+            }
+            removed[gone] = true;
+            collapsed++;
+        }
+    }while(collapsed>0);
+
+    // Compact the points, keeping their order, and rebuild the neighbourhood information
+    std::vector<int> newIndex(points.size(), -1);
+    UniqueList<Point> newPoints;
+    for (int i = 0; i < points.size(); ++i) {
+        if(!removed[i]){
+            newIndex[i] = newPoints.force_push_back(points[i]);
+        }
+    }
+
+    SegmentMap* segments = new SegmentMap;
+    PointMap* pointMap = new PointMap;
+    std::vector<Polygon> polygons;
+    for (int c = 0; c < cells.size(); ++c) {
+        for(int& v: cells[c]){
+            v = newIndex[v];
+            pointMap->insert(newPoints[v], c);
+        }
+
+        Polygon polygon(cells[c], newPoints.getList(), false);
+        std::vector<IndexSegment> polygonSegments;
+        polygon.getSegments(polygonSegments);
+        for(IndexSegment& s: polygonSegments){
+            segments->insert(s, c);
+        }
+
+        polygons.push_back(polygon);
+    }
+
+    this->originalPoints = (int) points.size();
+    this->remainingPoints = newPoints.size();
+
+    return Mesh<Polygon>(newPoints, polygons, segments, pointMap);
+}
+
+int ShortEdgeCollapser::getRemovedPoints() {
+    return this->originalPoints - this->remainingPoints;
+}
+
+int ShortEdgeCollapser::getDOFReduction(int degreesOfFreedomPerPoint) {
+    return degreesOfFreedomPerPoint*getRemovedPoints();
+}
+
+double ShortEdgeCollapser::getRelativeDOFReduction() {
+    return this->originalPoints>0? getRemovedPoints()/(double) this->originalPoints : 0;
+}
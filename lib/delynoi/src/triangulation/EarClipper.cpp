@@ -0,0 +1,211 @@
+#include <delynoi/triangulation/EarClipper.h>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    double cross(const Point& o, const Point& a, const Point& b){
+        return (a.getX() - o.getX())*(b.getY() - o.getY()) - (a.getY() - o.getY())*(b.getX() - o.getX());
+    }
+}
+
+int EarClipper::cellX(double x) {
+    return std::max(0, std::min(this->nX - 1, (int) std::floor((x - this->xMin)/this->cellSize)));
+}
+
+int EarClipper::cellY(double y) {
+    return std::max(0, std::min(this->nY - 1, (int) std::floor((y - this->yMin)/this->cellSize)));
+}
+
+double EarClipper::corner(const std::vector<int> &polygon, const std::vector<Point> &points, int i) {
+    return this->sign*cross(points[polygon[this->previous[i]]], points[polygon[i]], points[polygon[this->next[i]]]);
+}
+
+void EarClipper::classify(const std::vector<int> &polygon, const std::vector<Point> &points, int i) {
+    bool wasReflex = this->reflex[i];
+    this->reflex[i] = corner(polygon, points, i)<=0;
+    this->reflexVertices += (int) this->reflex[i] - (int) wasReflex;
+
+    // Only cutting a corner that is not an ear (in degenerate polygons) can make a convex vertex reflex
+    if(this->reflex[i] && !wasReflex){
+        const Point& p = points[polygon[i]];
+        this->cells[cellY(p.getY())*this->nX + cellX(p.getX())].push_back(i);
+    }
+    this->ear[i] = false;
+    if(this->reflex[i]){
+        return;
+    }
+    if(this->reflexVertices==0){
+        this->ear[i] = true;
+        return;
+    }
+
+    const Point& a = points[polygon[this->previous[i]]];
+    const Point& b = points[polygon[i]];
+    const Point& c = points[polygon[this->next[i]]];
+
+    // The corner is an ear if no other reflex vertex is inside it or on its sides (convex vertices can not be); only
+    // the grid cells touched by the bounding box of the corner are searched
+    double box[4] = {std::min(a.getX(), std::min(b.getX(), c.getX())), std::min(a.getY(), std::min(b.getY(), c.getY())),
+                     std::max(a.getX(), std::max(b.getX(), c.getX())), std::max(a.getY(), std::max(b.getY(), c.getY()))};
+    int i0 = cellX(box[0]), j0 = cellY(box[1]), i1 = cellX(box[2]), j1 = cellY(box[3]);
+
+    for (int cj = j0; cj <= j1; ++cj) {
+        for (int ci = i0; ci <= i1; ++ci) {
+            for(int j: this->cells[cj*this->nX + ci]){
+                if(this->removed[j] || !this->reflex[j] || j==i || j==this->previous[i] || j==this->next[i]){
+                    continue;
+                }
+
+                const Point& p = points[polygon[j]];
+                double x = p.getX(), y = p.getY();
+                if(x<box[0] || y<box[1] || x>box[2] || y>box[3] || (x==a.getX() && y==a.getY()) ||
+                   (x==c.getX() && y==c.getY())){
+                    continue;
+                }
+
+                if(this->sign*cross(a, b, p)>=0 && this->sign*cross(b, c, p)>=0 && this->sign*cross(c, a, p)>=0){
+                    return;
+                }
+            }
+        }
+    }
+
+    this->ear[i] = true;
+}
+
+std::vector<Trio<int>> EarClipper::triangulate(const std::vector<int> &polygon, const std::vector<Point> &points) {
+    int n = (int) polygon.size();
+    std::vector<Trio<int>> triangles;
+    if(n<3){
+        return triangles;
+    }
+    triangles.reserve(n - 2);
+
+    double area = 0;
+    for (int i = 0; i < n; ++i) {
+        const Point& p = points[polygon[i]];
+        const Point& q = points[polygon[(i + 1)%n]];
+        area += p.getX()*q.getY() - q.getX()*p.getY();
+    }
+    this->sign = area<0? -1 : 1;
+
+    this->previous.resize(n);
+    this->next.resize(n);
+    for (int i = 0; i < n; ++i) {
+        this->previous[i] = (i + n - 1)%n;
+        this->next[i] = (i + 1)%n;
+    }
+    this->removed.assign(n, false);
+    this->reflex.assign(n, false);
+    this->ear.assign(n, false);
+
+    // Grid with the reflex vertices (which never become reflex again once convex), about one per cell
+    double xMax = points[polygon[0]].getX(), yMax = points[polygon[0]].getY();
+    this->xMin = xMax;
+    this->yMin = yMax;
+    this->reflexVertices = 0;
+    for (int i = 0; i < n; ++i) {
+        const Point& p = points[polygon[i]];
+        this->xMin = std::min(this->xMin, p.getX());
+        this->yMin = std::min(this->yMin, p.getY());
+        xMax = std::max(xMax, p.getX());
+        yMax = std::max(yMax, p.getY());
+
+        this->reflex[i] = corner(polygon, points, i)<=0;
+        this->reflexVertices += this->reflex[i];
+    }
+
+    double width = xMax - this->xMin, height = yMax - this->yMin;
+    this->cellSize = std::max(std::sqrt(width*height/std::max(this->reflexVertices, 1)), std::max(width, height)/1024);
+    if(this->cellSize<=0){
+        this->cellSize = 1;
+    }
+    this->nX = (int) (width/this->cellSize) + 1;
+    this->nY = (int) (height/this->cellSize) + 1;
+    this->cells.assign(this->nX*this->nY, std::vector<int>());
+    for (int i = 0; i < n; ++i) {
+        if(this->reflex[i]){
+            const Point& p = points[polygon[i]];
+            this->cells[cellY(p.getY())*this->nX + cellX(p.getX())].push_back(i);
+        }
+    }
+
+    // Ears are clipped in the order they are found, going around the polygon, which gives better shaped triangles
+    // (and smaller ear tests) than always cutting next to the last ear
+    std::vector<int> candidates;
+    int first = 0;
+    for (int i = 0; i < n; ++i) {
+        classify(polygon, points, i);
+        if(this->ear[i]){
+            candidates.push_back(i);
+        }
+    }
+
+    int remaining = n;
+    int start = 0;
+    while(remaining>3){
+        int i = -1;
+        while(first<candidates.size() && i<0){
+            int c = candidates[first++];
+            if(!this->removed[c] && this->ear[c]){
+                i = c;
+            }
+        }
+
+        // A reflex vertex that became convex may have unblocked ears away from its neighbours, so all the remaining
+        // vertices are classified again before giving up
+        if(i<0){
+            int j = start;
+            do {
+                classify(polygon, points, j);
+                if(this->ear[j] && i<0){
+                    i = j;
+                } else if(this->ear[j]){
+                    candidates.push_back(j);
+                }
+                j = this->next[j];
+            } while(j != start);
+        }
+
+        // Without ears the polygon is degenerate (collinear or touching sides): the most convex corner is cut so the
+        // triangulation always ends
+        if(i<0){
+            i = start;
+            double best = corner(polygon, points, start);
+            for (int j = this->next[start]; j != start; j = this->next[j]) {
+                double o = corner(polygon, points, j);
+                if(o>best){
+                    best = o;
+                    i = j;
+                }
+            }
+        }
+
+        int a = this->previous[i], c = this->next[i];
+        if(corner(polygon, points, i)!=0){
+            triangles.push_back(Trio<int>(polygon[a], polygon[i], polygon[c]));
+        }
+
+        this->removed[i] = true;
+        this->reflexVertices -= this->reflex[i];
+        this->next[a] = c;
+        this->previous[c] = a;
+        start = a;
+        remaining--;
+
+        for(int v: {a, c}){
+            bool wasEar = this->ear[v];
+            classify(polygon, points, v);
+            if(this->ear[v] && !wasEar){
+                candidates.push_back(v);
+            }
+        }
+    }
+
+    int a = this->previous[start], c = this->next[start];
+    if(corner(polygon, points, start)!=0){
+        triangles.push_back(Trio<int>(polygon[a], polygon[start], polygon[c]));
+    }
+
+    return triangles;
+}
@@ -2,6 +2,9 @@
 #include <delynoi/config/DelynoiConfig.h>
 #include <delynoi/utilities/delynoi_utilities.h>
 #include <delynoi/models/basic/PointSegment.h>
+#include <delynoi/utilities/geometryFunctions.h>
+#include <algorithm>
+#include <cmath>
 
 namespace geometry_functions{
     double area2(Point p1, Point p2, Point p3){
@@ -49,4 +52,42 @@ namespace geometry_functions{
         return area;
     }
 
+    Point circumcenter(Point A, Point B, Point C){
+        double d = 2*(A.getX()*(B.getY() - C.getY()) + B.getX()*(C.getY() - A.getY()) + C.getX()*(A.getY() - B.getY()));
+
+        double uX = (A.squareNorm()*(B.getY() - C.getY()) + B.squareNorm()*(C.getY() - A.getY()) + C.squareNorm()*(A.getY() - B.getY()))/d;
+        double uY = (A.squareNorm()*(C.getX() - B.getX()) + B.squareNorm()*(A.getX() - C.getX()) + C.squareNorm()*(B.getX() - A.getX()))/d;
+
+        return Point(uX,uY);
+    }
+
+    void segmentCells(Point a, Point b, double margin, double xMin, double yMin, double cellSize, int nX, int nY,
+                      std::vector<int>& cells){
+        if(a.getX()>b.getX()){
+            std::swap(a, b);
+        }
+
+        double dx = b.getX() - a.getX(), dy = b.getY() - a.getY();
+        int i0 = std::max(0, (int) std::floor((a.getX() - margin - xMin)/cellSize));
+        int i1 = std::min(nX - 1, (int) std::floor((b.getX() + margin - xMin)/cellSize));
+
+        for (int i = i0; i <= i1; ++i) {
+            // Part of the segment within the margin of the column, and its extent in y
+            double x0 = std::max(a.getX(), xMin + i*cellSize - margin);
+            double x1 = std::min(b.getX(), xMin + (i + 1)*cellSize + margin);
+            if(x0>x1){
+                continue;
+            }
+
+            double y0 = dx>0? a.getY() + (x0 - a.getX())*dy/dx : a.getY();
+            double y1 = dx>0? a.getY() + (x1 - a.getX())*dy/dx : b.getY();
+
+            int j0 = std::max(0, (int) std::floor((std::min(y0, y1) - margin - yMin)/cellSize));
+            int j1 = std::min(nY - 1, (int) std::floor((std::max(y0, y1) + margin - yMin)/cellSize));
+
+            for (int j = j0; j <= j1; ++j) {
+                cells.push_back(j*nX + i);
+            }
+        }
+    }
 }
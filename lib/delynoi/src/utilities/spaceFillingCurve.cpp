@@ -0,0 +1,76 @@
+#include <delynoi/utilities/spaceFillingCurve.h>
+#include <algorithm>
+
+namespace delynoi_utilities {
+    uint64_t hilbertKey(uint32_t x, uint32_t y) {
+        uint32_t n = 1u << curveBits;
+        uint64_t key = 0;
+
+        for (uint32_t s = n/2; s > 0; s /= 2) {
+            uint32_t rx = (x & s) > 0;
+            uint32_t ry = (y & s) > 0;
+            key += (uint64_t) s*s*((3*rx) ^ ry);
+
+            // Rotates the quadrant so the curve inside it has the same orientation as the whole curve
+            if(ry==0){
+                if(rx==1){
+                    x = n - 1 - x;
+                    y = n - 1 - y;
+                }
+
+                std::swap(x, y);
+            }
+        }
+
+        return key;
+    }
+
+    uint64_t mortonKey(uint32_t x, uint32_t y) {
+        uint64_t key = 0;
+
+        for (int b = 0; b < curveBits; ++b) {
+            key |= (uint64_t) ((x >> b) & 1) << (2*b);
+            key |= (uint64_t) ((y >> b) & 1) << (2*b + 1);
+        }
+
+        return key;
+    }
+
+    std::vector<int> curveOrder(const std::vector<Point>& points, MeshOrdering ordering) {
+        int n = (int) points.size();
+        std::vector<int> order(n);
+        for (int i = 0; i < n; ++i) {
+            order[i] = i;
+        }
+
+        if(ordering==MeshOrdering::Original || n==0){
+            return order;
+        }
+
+        double xMin = points[0].getX(), yMin = points[0].getY(), xMax = xMin, yMax = yMin;
+        for(const Point& p: points){
+            xMin = std::min(xMin, p.getX());
+            yMin = std::min(yMin, p.getY());
+            xMax = std::max(xMax, p.getX());
+            yMax = std::max(yMax, p.getY());
+        }
+
+        // Same scale in both axes, so the curve follows the shape of the domain
+        double size = std::max(xMax - xMin, yMax - yMin);
+        double scale = size>0? ((1u << curveBits) - 1)/size : 0;
+
+        std::vector<uint64_t> keys(n);
+        for (int i = 0; i < n; ++i) {
+            uint32_t x = (uint32_t) ((points[i].getX() - xMin)*scale);
+            uint32_t y = (uint32_t) ((points[i].getY() - yMin)*scale);
+
+            keys[i] = ordering==MeshOrdering::Hilbert? hilbertKey(x, y) : mortonKey(x, y);
+        }
+
+        std::stable_sort(order.begin(), order.end(), [&keys](int a, int b){
+            return keys[a] < keys[b];
+        });
+
+        return order;
+    }
+}
@@ -1,6 +1,32 @@
 #include "delynoi/voronoi/DelaunayToVoronoi.h"
+#include <delynoi/utilities/parallel.h>
+#include <utilities/Profiler.h>
+#include <algorithm>
+#include <thread>
+#include <exception>
+
+namespace {
+    /*
+     * Circumcenter requested when crossing an edge into a triangle: the index of the triangle's circumcenter, or
+     * -(edge+1) when there is no triangle and the middle point of the (boundary) edge has to be created
+     */
+    int circumcenterRequest(DelaunayInfo& del, int triangle, int edge){
+        return triangle!=-1? del.circumcenterIndexes[triangle] : -(edge+1);
+    }
+}
 
 DelaunayToVoronoi::DelaunayToVoronoi(DelaunayInfo& del) {
+    PROFILE_PHASE("voronoi conversion");
+    int threads = delynoi_utilities::numberOfThreads();
+
+    if(threads==1 || del.realPoints.size()<2*threads){
+        convertSerial(del);
+    }else{
+        convertParallel(del, threads);
+    }
+}
+
+void DelaunayToVoronoi::convertSerial(DelaunayInfo &del) {
     SegmentMap* voronoiEdges = new SegmentMap;
     PointMap* pointMap = new PointMap;
     std::vector<Polygon> voronoiCells;
@@ -12,13 +38,14 @@ DelaunayToVoronoi::DelaunayToVoronoi(DelaunayInfo& del) {
         int index = del.realPoints[i];
         UniqueList<int> cellPoints;
         Point regionCenter = del.meshPoints[index];
-        EdgeData init_edge = del.edges[del.points[index].edge];
+        int initIndex = del.points[index].edge;
+        EdgeData init_edge = del.edges[initIndex];
 
         int t1 = init_edge.t1;
         int t2 = init_edge.t2;
 
-        int index1 = getCircumcenter(del, t1,del.points[index].edge);
-        int index2 = getCircumcenter(del, t2,del.points[index].edge);
+        int index1 = getCircumcenter(del, t1, initIndex);
+        int index2 = getCircumcenter(del, t2, initIndex);
 
         if(index1!=index2){
             IndexSegment e (index2,index1);
@@ -32,14 +59,13 @@ DelaunayToVoronoi::DelaunayToVoronoi(DelaunayInfo& del) {
         cellPoints.push_back(index1);
         pointMap->insert(del.circumcenters[index1], cellIndex);
 
-        EdgeData edge = del.edges[del.triangles[t1].nextEdge(index, init_edge, del.edgeMap)];
+        int currentEdge = del.triangulation->nextEdge(t1, index, initIndex);
+        EdgeData edge = del.edges[currentEdge];
 
-        while(!(edge==init_edge)){
+        while(currentEdge!=initIndex){
             t2 = t1;
             t1 = edge.t1!=t2? edge.t1 : edge.t2;
 
-            int currentEdge = del.edgeMap[Key(edge.p1, edge.p2)];
-
             index1 = getCircumcenter(del,t1,currentEdge);
             index2 = getCircumcenter(del,t2,currentEdge);
 
@@ -57,7 +83,8 @@ DelaunayToVoronoi::DelaunayToVoronoi(DelaunayInfo& del) {
             pointMap->insert(del.circumcenters[index1], cellIndex);
 
             if(t1!=-1){
-                edge = del.edges[del.triangles[t1].nextEdge(index, edge, del.edgeMap)];
+                currentEdge = del.triangulation->nextEdge(t1, index, currentEdge);
+                edge = del.edges[currentEdge];
             }else{
                 break;
             }
@@ -93,7 +120,7 @@ DelaunayToVoronoi::DelaunayToVoronoi(DelaunayInfo& del) {
         std::vector<Point>& pointList = del.circumcenters.getList();
         std::vector<int>& cellPointsList = cellPoints.getList();
 
-        Polygon p = Polygon(cellPointsList, pointList);
+        Polygon p = Polygon(cellPointsList, pointList, false);
         p.fixCCW(pointList);
 
         voronoiCells.push_back(p);
@@ -102,12 +129,213 @@ DelaunayToVoronoi::DelaunayToVoronoi(DelaunayInfo& del) {
     UniqueList<Point>& points = del.circumcenters;
 
     this->mesh = Mesh<Polygon>(points, voronoiCells, voronoiEdges, pointMap);
+    this->mesh.reorder(DelynoiConfig::instance()->getMeshOrdering());
 }
 
 
+void DelaunayToVoronoi::convertParallel(DelaunayInfo &del, int threads) {
+    int n = del.realPoints.size();
+
+    // Walk the star of every point concurrently, recording the circumcenter requests of each step (a pair: the
+    // triangle being entered and the one being left, in the order the serial algorithm asks for them)
+    std::vector<std::vector<int>> blockRequests(threads);
+    std::vector<std::vector<int>> blockSteps(threads);
+    std::vector<char> open(n);
+    int blockSize = (n + threads - 1)/threads;
+
+    delynoi_utilities::parallelFor(n, threads, [&](int begin, int end) {
+        std::vector<int>& requests = blockRequests[begin/blockSize];
+        std::vector<int>& steps = blockSteps[begin/blockSize];
+
+        for (int i = begin; i < end; ++i) {
+            int index = del.realPoints[i];
+            int initIndex = del.points[index].edge;
+            EdgeData init_edge = del.edges[initIndex];
+
+            int t1 = init_edge.t1;
+            int t2 = init_edge.t2;
+            int cellSteps = 1;
+
+            requests.push_back(circumcenterRequest(del, t1, initIndex));
+            requests.push_back(circumcenterRequest(del, t2, initIndex));
+
+            int currentEdge = del.triangulation->nextEdge(t1, index, initIndex);
+            EdgeData edge = del.edges[currentEdge];
+
+            while(currentEdge!=initIndex){
+                t2 = t1;
+                t1 = edge.t1!=t2? edge.t1 : edge.t2;
+
+                requests.push_back(circumcenterRequest(del, t1, currentEdge));
+                requests.push_back(circumcenterRequest(del, t2, currentEdge));
+                cellSteps++;
+
+                if(t1!=-1){
+                    currentEdge = del.triangulation->nextEdge(t1, index, currentEdge);
+                    edge = del.edges[currentEdge];
+                }else{
+                    break;
+                }
+            }
+
+            steps.push_back(cellSteps);
+            open[i] = edge.t2==-1;
+        }
+    });
+
+    // Number the new points and build the cell connectivity in the serial order, so the result does not depend on
+    // the number of threads
+    std::vector<int> cellOffsets(1, 0);
+    std::vector<int> cellVertices;
+    std::vector<std::pair<IndexSegment,int>> cellEdges;
+    std::vector<std::pair<int,int>> vertexCells;
+
+    auto resolve = [&](int request) -> int {
+        if(request>=0){
+            return request;
+        }
+
+        int edge = -request - 1;
+        Point middlePoint = IndexSegment(del.edges[edge].p1, del.edges[edge].p2).middlePoint(del.meshPoints);
+        middlePoint.setBoundary();
+
+        return del.circumcenters.push_back(middlePoint);
+    };
+
+    auto addVertex = [&](int vertex, int cell) {
+        vertexCells.push_back(std::make_pair(vertex, cell));
+        if(std::find(cellVertices.begin() + cellOffsets.back(), cellVertices.end(), vertex)==cellVertices.end()){
+            cellVertices.push_back(vertex);
+        }
+    };
+
+    int cell = 0;
+    for (int b = 0; b < threads; ++b) {
+        std::vector<int>& requests = blockRequests[b];
+        int r = 0;
+
+        for(int cellSteps: blockSteps[b]){
+            for (int k = 0; k < cellSteps; ++k) {
+                int index1 = resolve(requests[r++]);
+                int index2 = resolve(requests[r++]);
+
+                if(index1!=index2){
+                    cellEdges.push_back(std::make_pair(IndexSegment(index2, index1), cell));
+                    addVertex(index2, cell);
+                }
+                addVertex(index1, cell);
+            }
+
+            if(open[cell]){
+                int firstPoint = cellVertices[cellOffsets.back()];
+                int lastPoint = cellVertices.back();
+                Point regionCenter = del.meshPoints[del.realPoints[cell]];
+
+                if(geometry_functions::collinear(del.circumcenters[firstPoint],regionCenter,del.circumcenters[lastPoint])){
+                    cellEdges.push_back(std::make_pair(IndexSegment(lastPoint, firstPoint), cell));
+                } else{
+                    regionCenter.setBoundary();
+                    int regionIndex = del.circumcenters.push_back(regionCenter);
+                    addVertex(regionIndex, cell);
+
+                    cellEdges.push_back(std::make_pair(IndexSegment(lastPoint, regionIndex), cell));
+                    cellEdges.push_back(std::make_pair(IndexSegment(regionIndex, firstPoint), cell));
+                }
+            }
+
+            cellOffsets.push_back(cellVertices.size());
+            cell++;
+        }
+
+        std::vector<int>().swap(requests);
+    }
+
+    // Build the neighbourhood maps (each in its own thread, inserting in the serial order) while the cells are
+    // created concurrently
+    std::vector<Point>& pointList = del.circumcenters.getList();
+    SegmentMap* voronoiEdges = new SegmentMap;
+    PointMap* pointMap = new PointMap;
+    DelynoiConfig* config = DelynoiConfig::instance();
+    std::exception_ptr edgesError, pointsError;
+
+    // As in parallelFor, the exceptions are caught in the threads and rethrown here once both are joined
+    std::thread edgesThread([&]() {
+        try{
+            DelynoiConfig::activate(config);
+            for(std::pair<IndexSegment,int>& e: cellEdges){
+                voronoiEdges->insert(e.first, e.second);
+            }
+        }catch(...){
+            edgesError = std::current_exception();
+        }
+    });
+
+    std::thread pointsThread([&]() {
+        try{
+            DelynoiConfig::activate(config);
+
+            // Group the cells of each point, keeping the order in which they were found
+            std::vector<int> offsets(pointList.size() + 1, 0);
+            for(std::pair<int,int>& v: vertexCells){
+                offsets[v.first + 1]++;
+            }
+            for (int i = 0; i < (int) pointList.size(); ++i) {
+                offsets[i + 1] += offsets[i];
+            }
+
+            std::vector<int> cells(vertexCells.size());
+            std::vector<int> next(offsets.begin(), offsets.end() - 1);
+            for(std::pair<int,int>& v: vertexCells){
+                cells[next[v.first]++] = v.second;
+            }
+
+            for (int i = 0; i < (int) pointList.size(); ++i) {
+                if(offsets[i]<offsets[i+1]){
+                    std::vector<int> neighbours(cells.begin() + offsets[i], cells.begin() + offsets[i+1]);
+                    pointMap->insert(pointList[i], neighbours);
+                }
+            }
+        }catch(...){
+            pointsError = std::current_exception();
+        }
+    });
+
+    std::vector<Polygon> voronoiCells(n);
+    std::exception_ptr cellsError;
+    try{
+        delynoi_utilities::parallelFor(n, std::max(1, threads - 2), [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                std::vector<int> cellPointsList(cellVertices.begin() + cellOffsets[i],
+                                                cellVertices.begin() + cellOffsets[i+1]);
+
+                Polygon p = Polygon(cellPointsList, pointList, false);
+                p.fixCCW(pointList);
+
+                voronoiCells[i] = p;
+            }
+        });
+    }catch(...){
+        cellsError = std::current_exception();
+    }
+
+    edgesThread.join();
+    pointsThread.join();
+
+    for(std::exception_ptr error: {cellsError, edgesError, pointsError}){
+        if(error){
+            delete voronoiEdges;
+            delete pointMap;
+            std::rethrow_exception(error);
+        }
+    }
+
+    this->mesh = Mesh<Polygon>(del.circumcenters, voronoiCells, voronoiEdges, pointMap);
+    this->mesh.reorder(DelynoiConfig::instance()->getMeshOrdering());
+}
+
 int DelaunayToVoronoi::getCircumcenter(DelaunayInfo& del, int triangle, int edge) {
     if(triangle!=-1){
-        return del.triangles[triangle].getCircumcenterIndex();
+        return del.circumcenterIndexes[triangle];
     }else{
         Point middlePoint = IndexSegment(del.edges[edge].p1, del.edges[edge].p2).middlePoint(del.meshPoints);
         middlePoint.setBoundary();
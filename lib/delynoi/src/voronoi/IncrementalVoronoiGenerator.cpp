@@ -0,0 +1,793 @@
+#include <delynoi/voronoi/IncrementalVoronoiGenerator.h>
+#include <delynoi/voronoi/TriangleDelaunayGenerator.h>
+#include <delynoi/config/DelynoiConfig.h>
+#include <utilities/Profiler.h>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    /*
+     * Twice the signed area of the triangle abc (positive if counterclockwise)
+     */
+    double orientation(const Point& a, const Point& b, const Point& c){
+        return (b.getX() - a.getX())*(c.getY() - a.getY()) - (b.getY() - a.getY())*(c.getX() - a.getX());
+    }
+
+    /*
+     * Positive if d is inside the circumcircle of the counterclockwise triangle abc (zero is returned when the value is
+     * below the rounding error, so that cocircular points never cause flips)
+     */
+    double inCircle(const Point& a, const Point& b, const Point& c, const Point& d){
+        double adx = a.getX() - d.getX(), ady = a.getY() - d.getY();
+        double bdx = b.getX() - d.getX(), bdy = b.getY() - d.getY();
+        double cdx = c.getX() - d.getX(), cdy = c.getY() - d.getY();
+
+        double ad = adx*adx + ady*ady, bd = bdx*bdx + bdy*bdy, cd = cdx*cdx + cdy*cdy;
+        double det = ad*(bdx*cdy - cdx*bdy) + bd*(cdx*ady - adx*cdy) + cd*(adx*bdy - bdx*ady);
+        double scale = ad*(std::abs(bdx*cdy) + std::abs(cdx*bdy)) + bd*(std::abs(cdx*ady) + std::abs(adx*cdy)) +
+                       cd*(std::abs(adx*bdy) + std::abs(bdx*ady));
+
+        return std::abs(det) > 1e-12*scale? det : 0;
+    }
+
+    /*
+     * Signed distance from p to the line through a and b (positive on the left)
+     */
+    double distance(const Point& a, const Point& b, const Point& p){
+        double length = std::sqrt(std::pow(b.getX() - a.getX(), 2) + std::pow(b.getY() - a.getY(), 2));
+        return orientation(a, b, p)/length;
+    }
+
+    /*
+     * Maximum number of boundary edges split in a single update
+     */
+    const int MAX_SPLITS = 1000;
+}
+
+IncrementalVoronoiGenerator::IncrementalVoronoiGenerator(std::vector<Point> &seeds, Region region) {
+    TriangleDelaunayGenerator generator(seeds, region);
+    DelaunayInfo del = generator.getConformingDelaunay();
+    TriangulationData& data = *del.triangulation;
+
+    PROFILE_PHASE("voronoi conversion");
+    this->points = del.meshPoints;
+    this->pointTriangle.assign(points.size(), -1);
+    this->cells.resize(points.size());
+
+    int n = data.numberOfTriangles();
+    this->triangles.resize(3*n);
+    this->neighbours.resize(3*n);
+    this->triangleCircumcenters.assign(n, -1);
+
+    for (int t = 0; t < n; ++t) {
+        for (int k = 0; k < 3; ++k) {
+            triangles[3*t+k] = data.triangleVertex(t, k);
+            neighbours[3*t+k] = data.neighbour(t, k);
+            pointTriangle[triangles[3*t+k]] = t;
+        }
+    }
+    this->lastTriangle = n>0? 0 : -1;
+
+    for (int v = 0; v < points.size(); ++v) {
+        if(pointTriangle[v]>=0){
+            computeCell(v);
+        }
+    }
+}
+
+int IncrementalVoronoiGenerator::newTriangle(int a, int b, int c) {
+    int t;
+    if(freeTriangles.empty()){
+        t = (int) triangleCircumcenters.size();
+        triangles.resize(3*t + 3);
+        neighbours.resize(3*t + 3);
+        triangleCircumcenters.push_back(-1);
+    }else{
+        t = freeTriangles.back();
+        freeTriangles.pop_back();
+    }
+
+    neighbours[3*t] = neighbours[3*t+1] = neighbours[3*t+2] = -1;
+    setTriangle(t, a, b, c);
+
+    return t;
+}
+
+void IncrementalVoronoiGenerator::setTriangle(int t, int a, int b, int c) {
+    triangles[3*t] = a;
+    triangles[3*t+1] = b;
+    triangles[3*t+2] = c;
+    triangleCircumcenters[t] = -1;
+
+    pointTriangle[a] = pointTriangle[b] = pointTriangle[c] = t;
+    modifiedTriangles.push_back(t);
+}
+
+void IncrementalVoronoiGenerator::link(int t, int k, int n) {
+    neighbours[3*t+k] = n;
+    if(n<0){
+        return;
+    }
+
+    int first = triangles[3*t+(k+1)%3], second = triangles[3*t+(k+2)%3];
+    for (int m = 0; m < 3; ++m) {
+        if(triangles[3*n+(m+1)%3]==second && triangles[3*n+(m+2)%3]==first){
+            neighbours[3*n+m] = t;
+            return;
+        }
+    }
+}
+
+int IncrementalVoronoiGenerator::addPoint(const Point &p) {
+    points.push_back(p);
+    pointTriangle.push_back(-1);
+    cells.push_back(std::vector<int>());
+
+    return (int) points.size() - 1;
+}
+
+int IncrementalVoronoiGenerator::corner(int t, int v) {
+    return triangles[3*t]==v? 0 : (triangles[3*t+1]==v? 1 : 2);
+}
+
+int IncrementalVoronoiGenerator::locate(const Point &p, int &edge, int &vertex, int hint) {
+    double tolerance = DelynoiConfig::instance()->getTolerance();
+    int n = (int) triangleCircumcenters.size();
+    edge = -1;
+    vertex = -1;
+
+    // Index of the neighbour to move to, or -2 if the triangle contains the point
+    auto step = [&](int t) -> int {
+        for (int k = 0; k < 3; ++k) {
+            if(distance(points[triangles[3*t+(k+1)%3]], points[triangles[3*t+(k+2)%3]], p) < -tolerance){
+                return neighbours[3*t+k];
+            }
+        }
+        return -2;
+    };
+
+    // Walk towards the point; if the walk leaves the domain (which may not be convex) or takes too long, check all
+    // the triangles
+    int t = hint>=0 && triangles[3*hint]>=0? hint : (lastTriangle>=0 && triangles[3*lastTriangle]>=0? lastTriangle : -1);
+    bool found = false;
+    for (int steps = 0; t>=0 && steps < n; ++steps) {
+        int next = step(t);
+        if(next==-2){
+            found = true;
+            break;
+        }
+        t = next;
+    }
+
+    if(!found){
+        t = -1;
+        for (int i = 0; i < n && t<0; ++i) {
+            if(triangles[3*i]>=0 && step(i)==-2){
+                t = i;
+            }
+        }
+
+        if(t<0){
+            return -1;
+        }
+    }
+
+    lastTriangle = t;
+    for (int k = 0; k < 3; ++k) {
+        if(points[triangles[3*t+k]]==p){
+            vertex = triangles[3*t+k];
+            return t;
+        }
+    }
+
+    for (int k = 0; k < 3; ++k) {
+        if(std::abs(distance(points[triangles[3*t+(k+1)%3]], points[triangles[3*t+(k+2)%3]], p)) < tolerance){
+            edge = k;
+        }
+    }
+
+    return t;
+}
+
+int IncrementalVoronoiGenerator::insertInTriangle(int t, int v) {
+    int a = triangles[3*t], b = triangles[3*t+1], c = triangles[3*t+2];
+    int Na = neighbours[3*t], Nb = neighbours[3*t+1], Nc = neighbours[3*t+2];
+
+    int t2 = newTriangle(v, c, a);
+    int t3 = newTriangle(v, a, b);
+    setTriangle(t, v, b, c);
+
+    link(t, 0, Na);
+    neighbours[3*t+1] = t2;
+    neighbours[3*t+2] = t3;
+
+    link(t2, 0, Nb);
+    neighbours[3*t2+1] = t3;
+    neighbours[3*t2+2] = t;
+
+    link(t3, 0, Nc);
+    neighbours[3*t3+1] = t;
+    neighbours[3*t3+2] = t2;
+
+    std::vector<int> pending = {t, t2, t3};
+    legalize(pending);
+
+    return v;
+}
+
+int IncrementalVoronoiGenerator::insertInEdge(int t, int k, int v) {
+    int c = triangles[3*t+k], a = triangles[3*t+(k+1)%3], b = triangles[3*t+(k+2)%3];
+    int Na = neighbours[3*t+(k+1)%3], Nb = neighbours[3*t+(k+2)%3];
+    int n = neighbours[3*t+k];
+
+    if(n<0){
+        points[v].setBoundary();
+    }
+
+    int t2 = newTriangle(v, c, a);
+    setTriangle(t, v, b, c);
+
+    link(t, 0, Na);
+    neighbours[3*t+1] = t2;
+    neighbours[3*t+2] = -1;
+
+    link(t2, 0, Nb);
+    neighbours[3*t2+1] = -1;
+    neighbours[3*t2+2] = t;
+
+    std::vector<int> pending = {t, t2};
+
+    if(n>=0){
+        int j = neighbours[3*n]==t? 0 : (neighbours[3*n+1]==t? 1 : 2);
+        int d = triangles[3*n+j];
+        int Ma = neighbours[3*n+(j+2)%3], Mb = neighbours[3*n+(j+1)%3];
+
+        int t4 = newTriangle(v, d, b);
+        setTriangle(n, v, a, d);
+
+        link(n, 0, Mb);
+        neighbours[3*n+1] = t4;
+        neighbours[3*n+2] = t2;
+        neighbours[3*t2+1] = n;
+
+        link(t4, 0, Ma);
+        neighbours[3*t4+1] = t;
+        neighbours[3*t4+2] = n;
+        neighbours[3*t+2] = t4;
+
+        pending.push_back(n);
+        pending.push_back(t4);
+    }
+
+    legalize(pending);
+
+    return v;
+}
+
+void IncrementalVoronoiGenerator::legalize(std::vector<int> &pending) {
+    // Every pending triangle has the inserted point as first vertex; the edge in front of it is checked
+    while(!pending.empty()){
+        int t = pending.back();
+        pending.pop_back();
+
+        int n = neighbours[3*t];
+        if(n<0){
+            continue;
+        }
+
+        int p = triangles[3*t], a = triangles[3*t+1], b = triangles[3*t+2];
+        int j = neighbours[3*n]==t? 0 : (neighbours[3*n+1]==t? 1 : 2);
+        int d = triangles[3*n+j];
+
+        if(inCircle(points[p], points[a], points[b], points[d]) <= 0){
+            continue;
+        }
+
+        flip(t);
+        pending.push_back(t);
+        pending.push_back(n);
+    }
+}
+
+void IncrementalVoronoiGenerator::flip(int t) {
+    int n = neighbours[3*t];
+    int p = triangles[3*t], a = triangles[3*t+1], b = triangles[3*t+2];
+    int j = neighbours[3*n]==t? 0 : (neighbours[3*n+1]==t? 1 : 2);
+    int d = triangles[3*n+j];
+
+    int Ta = neighbours[3*t+1], Tb = neighbours[3*t+2];
+    int Na = neighbours[3*n+(j+1)%3], Nb = neighbours[3*n+(j+2)%3];
+
+    setTriangle(t, p, a, d);
+    setTriangle(n, p, d, b);
+
+    link(t, 0, Na);
+    neighbours[3*t+1] = n;
+    link(t, 2, Tb);
+
+    link(n, 0, Nb);
+    link(n, 1, Ta);
+    neighbours[3*n+2] = t;
+}
+
+void IncrementalVoronoiGenerator::restoreDelaunay(std::vector<int> &pending) {
+    while(!pending.empty()){
+        int t = pending.back();
+        pending.pop_back();
+        if(triangles[3*t]<0){
+            continue;
+        }
+
+        for (int k = 0; k < 3; ++k) {
+            int n = neighbours[3*t+k];
+            if(n<0){
+                continue;
+            }
+
+            int j = neighbours[3*n]==t? 0 : (neighbours[3*n+1]==t? 1 : 2);
+            if(inCircle(points[triangles[3*t]], points[triangles[3*t+1]], points[triangles[3*t+2]],
+                        points[triangles[3*n+j]]) <= 0){
+                continue;
+            }
+
+            // The vertices are rotated so the edge to flip is in front of the first one
+            int a = triangles[3*t+k], b = triangles[3*t+(k+1)%3], c = triangles[3*t+(k+2)%3];
+            int Na = neighbours[3*t+k], Nb = neighbours[3*t+(k+1)%3], Nc = neighbours[3*t+(k+2)%3];
+            triangles[3*t] = a, triangles[3*t+1] = b, triangles[3*t+2] = c;
+            neighbours[3*t] = Na, neighbours[3*t+1] = Nb, neighbours[3*t+2] = Nc;
+
+            flip(t);
+            pending.push_back(t);
+            pending.push_back(n);
+            break;
+        }
+    }
+}
+
+bool IncrementalVoronoiGenerator::relocate(int v, const Point &p) {
+    double tolerance = DelynoiConfig::instance()->getTolerance();
+
+    // The point can keep its triangles if the new position sees every edge of the polygon around it from inside
+    std::vector<int> star;
+    int t = pointTriangle[v];
+    do{
+        int c = corner(t, v);
+        if(distance(points[triangles[3*t+(c+1)%3]], points[triangles[3*t+(c+2)%3]], p) < tolerance){
+            return false;
+        }
+
+        star.push_back(t);
+        t = neighbours[3*t+(c+1)%3];
+    }while(t>=0 && t!=star[0]);
+
+    if(t<0){
+        return false;
+    }
+
+    points[v] = Point(p.getX(), p.getY());
+    for(int s: star){
+        setTriangle(s, triangles[3*s], triangles[3*s+1], triangles[3*s+2]);
+    }
+
+    restoreDelaunay(star);
+    lastTriangle = pointTriangle[v];
+
+    return true;
+}
+
+void IncrementalVoronoiGenerator::splitEncroachedEdges(VoronoiUpdate &update) {
+    int splits = 0;
+
+    for (int i = 0; i < modifiedTriangles.size() && splits < MAX_SPLITS; ++i) {
+        int t = modifiedTriangles[i];
+        if(triangles[3*t]<0){
+            continue;
+        }
+
+        for (int k = 0; k < 3; ++k) {
+            if(neighbours[3*t+k]>=0){
+                continue;
+            }
+
+            Point& c = points[triangles[3*t+k]];
+            Point& a = points[triangles[3*t+(k+1)%3]];
+            Point& b = points[triangles[3*t+(k+2)%3]];
+            Point ca = a - c, cb = b - c;
+            double dot = ca.getX()*cb.getX() + ca.getY()*cb.getY();
+
+            if(dot < -1e-12*std::sqrt(ca.squareNorm()*cb.squareNorm())){
+                IndexSegment edge(triangles[3*t+(k+1)%3], triangles[3*t+(k+2)%3]);
+                Point middle = edge.middlePoint(points);
+                middle.setBoundary();
+
+                update.insertedCells.push_back(insertInEdge(t, k, addPoint(middle)));
+                splits++;
+
+                // The triangle changed, check it again
+                i--;
+                break;
+            }
+        }
+    }
+}
+
+bool IncrementalVoronoiGenerator::insertPoint(Point seed, VoronoiUpdate &update, int id) {
+    // Seeds are inside the domain, whatever flag they have (points on the boundary are marked when inserted)
+    Point p(seed.getX(), seed.getY());
+    int edge, vertex;
+    int t = locate(p, edge, vertex);
+
+    if(t<0){
+        throw std::invalid_argument("Can not insert a seed outside the domain");
+    }
+
+    if(vertex>=0){
+        return false;
+    }
+
+    int v = id;
+    if(v<0){
+        v = addPoint(p);
+        update.insertedCells.push_back(v);
+    }else{
+        points[v] = p;
+    }
+
+    if(edge<0){
+        insertInTriangle(t, v);
+    }else{
+        insertInEdge(t, edge, v);
+    }
+
+    return true;
+}
+
+void IncrementalVoronoiGenerator::finishUpdate(VoronoiUpdate &update) {
+    splitEncroachedEdges(update);
+
+    // Triangles are modified several times in an update, so their vertices are marked to collect each one once
+    std::vector<int> changed;
+    changedPoints.resize(points.size(), false);
+    for(int t: modifiedTriangles){
+        if(triangles[3*t]<0){
+            continue;
+        }
+
+        for (int k = 0; k < 3; ++k) {
+            int v = triangles[3*t+k];
+            if(!changedPoints[v]){
+                changedPoints[v] = true;
+                changed.push_back(v);
+            }
+        }
+    }
+    for(int v: changed){
+        changedPoints[v] = false;
+    }
+    std::sort(changed.begin(), changed.end());
+
+    for(int v: changed){
+        computeCell(v);
+    }
+
+    update.changedCells = changed;
+    std::sort(update.insertedCells.begin(), update.insertedCells.end());
+    std::sort(update.removedCells.begin(), update.removedCells.end());
+    std::sort(update.skippedCells.begin(), update.skippedCells.end());
+
+    modifiedTriangles.clear();
+}
+
+VoronoiUpdate IncrementalVoronoiGenerator::insert(Point p) {
+    PROFILE_PHASE("voronoi update");
+    VoronoiUpdate update;
+
+    insertPoint(p, update);
+    finishUpdate(update);
+
+    return update;
+}
+
+VoronoiUpdate IncrementalVoronoiGenerator::insert(std::vector<Point> &seeds) {
+    PROFILE_PHASE("voronoi update");
+    VoronoiUpdate update;
+
+    for(Point& p: seeds){
+        insertPoint(p, update);
+    }
+    finishUpdate(update);
+
+    return update;
+}
+
+VoronoiUpdate IncrementalVoronoiGenerator::remove(int cell) {
+    PROFILE_PHASE("voronoi update");
+    VoronoiUpdate update;
+
+    removePoint(cell);
+    update.removedCells.push_back(cell);
+    finishUpdate(update);
+
+    return update;
+}
+
+VoronoiUpdate IncrementalVoronoiGenerator::move(std::vector<int> &ids, std::vector<Point> &positions, bool skipOutside) {
+    PROFILE_PHASE("voronoi update");
+    VoronoiUpdate update;
+
+    // The whole batch is checked before moving any seed, so an invalid entry leaves the triangulation untouched. Ids
+    // must be distinct, as a seed moved onto an existing point disappears and could not be moved again
+    if(ids.size()!=positions.size()){
+        throw std::invalid_argument("There must be one position for each moved seed");
+    }
+
+    std::vector<char> moved(points.size(), false);
+    std::vector<char> inside(ids.size(), true);
+    for (int i = 0; i < (int) ids.size(); ++i) {
+        int cell = ids[i];
+        if(cell<0 || cell>=(int) points.size() || pointTriangle[cell]<0){
+            throw std::invalid_argument("There is no cell with the given id");
+        }
+        if(points[cell].isInBoundary()){
+            throw std::invalid_argument("Cells on the boundary of the domain can not be removed");
+        }
+        if(moved[cell]){
+            throw std::invalid_argument("A seed can not be moved twice in the same update");
+        }
+
+        // The new position is searched from the triangle of the seed, as seeds are usually moved short distances
+        int edge, vertex;
+        inside[i] = locate(positions[i], edge, vertex, pointTriangle[cell])>=0;
+        if(!inside[i] && !skipOutside){
+            throw std::invalid_argument("Can not move a seed outside the domain");
+        }
+
+        moved[cell] = true;
+    }
+
+    for (int i = 0; i < (int) ids.size(); ++i) {
+        if(!inside[i]){
+            update.skippedCells.push_back(ids[i]);
+            continue;
+        }
+
+        // A seed that stays inside the polygon around it only needs edge flips; otherwise it is removed and inserted
+        // again with the same id, and the location of the new position starts from the triangles that filled the hole
+        if(relocate(ids[i], positions[i])){
+            continue;
+        }
+
+        removePoint(ids[i]);
+        if(!insertPoint(positions[i], update, ids[i])){
+            update.removedCells.push_back(ids[i]);
+        }
+    }
+    finishUpdate(update);
+
+    return update;
+}
+
+void IncrementalVoronoiGenerator::removePoint(int cell) {
+    if(cell<0 || cell>=points.size() || pointTriangle[cell]<0){
+        throw std::invalid_argument("There is no cell with the given id");
+    }
+    if(points[cell].isInBoundary()){
+        throw std::invalid_argument("Cells on the boundary of the domain can not be removed");
+    }
+
+    // Star of the point: its triangles and the polygon around it (counterclockwise), with the triangle on the other
+    // side of each polygon edge
+    std::vector<int> star, polygon, outside;
+    int t = pointTriangle[cell];
+    do{
+        int c = corner(t, cell);
+        star.push_back(t);
+        polygon.push_back(triangles[3*t+(c+1)%3]);
+        outside.push_back(neighbours[3*t+c]);
+
+        t = neighbours[3*t+(c+1)%3];
+    }while(t>=0 && t!=star[0]);
+
+    if(t<0){
+        throw std::invalid_argument("Cells on the boundary of the domain can not be removed");
+    }
+
+    for(int s: star){
+        triangles[3*s] = -1;
+    }
+
+    // Retriangulate the polygon cutting Delaunay ears (convex corners whose circumcircle contains no other vertex of
+    // the polygon); outside[i] is the triangle on the other side of the edge from polygon[i] to polygon[i+1]
+    std::vector<int> created;
+    while(polygon.size()>=3){
+        int m = (int) polygon.size();
+        int ear = -1, convex = -1;
+
+        for (int i = 0; i < m && ear<0; ++i) {
+            Point& a = points[polygon[(i+m-1)%m]];
+            Point& b = points[polygon[i]];
+            Point& c = points[polygon[(i+1)%m]];
+
+            if(orientation(a, b, c)<=0){
+                continue;
+            }
+            if(convex<0){
+                convex = i;
+            }
+
+            bool empty = true;
+            for (int j = 0; j < m && empty; ++j) {
+                if(j!=i && j!=(i+m-1)%m && j!=(i+1)%m){
+                    empty = inCircle(a, b, c, points[polygon[j]])<=0;
+                }
+            }
+
+            if(empty){
+                ear = i;
+            }
+        }
+
+        if(ear<0){
+            ear = convex>=0? convex : 0;
+        }
+
+        int previous = (ear+m-1)%m, next = (ear+1)%m;
+        int triangle = newTriangle(polygon[previous], polygon[ear], polygon[next]);
+        created.push_back(triangle);
+
+        link(triangle, 0, outside[ear]);
+        link(triangle, 2, outside[previous]);
+
+        if(m==3){
+            link(triangle, 1, outside[next]);
+            break;
+        }
+
+        outside[previous] = triangle;
+        polygon.erase(polygon.begin() + ear);
+        outside.erase(outside.begin() + ear);
+    }
+
+    freeTriangles.insert(freeTriangles.end(), star.begin(), star.end());
+
+    pointTriangle[cell] = -1;
+    cells[cell].clear();
+    lastTriangle = created.empty()? -1 : created[0];
+}
+
+int IncrementalVoronoiGenerator::circumcenter(int t) {
+    if(triangleCircumcenters[t]<0){
+        Point c = geometry_functions::circumcenter(points[triangles[3*t]], points[triangles[3*t+1]],
+                                                   points[triangles[3*t+2]]);
+        triangleCircumcenters[t] = voronoiPoints.push_back(c);
+    }
+
+    return triangleCircumcenters[t];
+}
+
+void IncrementalVoronoiGenerator::computeCell(int v) {
+    // Go clockwise until the boundary is found (or all around the point)
+    int t = pointTriangle[v];
+    int c = corner(t, v);
+    int start = t;
+    bool boundary = false;
+
+    while(true){
+        int previous = neighbours[3*t+(c+2)%3];
+        if(previous<0){
+            boundary = true;
+            break;
+        }
+
+        t = previous;
+        c = corner(t, v);
+        if(t==start){
+            break;
+        }
+    }
+
+    UniqueList<int> cell;
+    auto add = [&](int index) { cell.push_back(index); };
+
+    if(boundary){
+        Point middle = IndexSegment(v, triangles[3*t+(c+1)%3]).middlePoint(points);
+        middle.setBoundary();
+        add(voronoiPoints.push_back(middle));
+    }
+
+    // Now counterclockwise, adding the circumcenters (and the middle point of the last edge on the boundary)
+    int first = t;
+    while(true){
+        add(circumcenter(t));
+
+        int next = neighbours[3*t+(c+1)%3];
+        if(next<0){
+            Point middle = IndexSegment(v, triangles[3*t+(c+2)%3]).middlePoint(points);
+            middle.setBoundary();
+            add(voronoiPoints.push_back(middle));
+            break;
+        }
+
+        t = next;
+        c = corner(t, v);
+        if(t==first){
+            break;
+        }
+    }
+
+    std::vector<Point>& pointList = voronoiPoints.getList();
+    if(boundary){
+        int firstPoint = cell[0];
+        int lastPoint = cell[cell.size()-1];
+
+        if(!geometry_functions::collinear(pointList[firstPoint], points[v], pointList[lastPoint])){
+            Point center = points[v];
+            center.setBoundary();
+            add(voronoiPoints.push_back(center));
+        }
+    }
+
+    std::vector<int>& cellPoints = cell.getList();
+    if(geometry_functions::area(voronoiPoints.getList(), cellPoints)<0){
+        std::reverse(cellPoints.begin(), cellPoints.end());
+    }
+
+    cells[v] = cellPoints;
+}
+
+bool IncrementalVoronoiGenerator::contains(const Point &p) {
+    int edge, vertex;
+    return locate(p, edge, vertex)>=0;
+}
+
+Point IncrementalVoronoiGenerator::getSeed(int cell) {
+    return points[cell];
+}
+
+std::vector<Point> IncrementalVoronoiGenerator::getCellPoints(int cell) {
+    std::vector<Point> cellPoints;
+    for(int i: cells[cell]){
+        cellPoints.push_back(voronoiPoints[i]);
+    }
+
+    return cellPoints;
+}
+
+std::vector<int> IncrementalVoronoiGenerator::getCellIds() {
+    std::vector<int> ids;
+    for (int v = 0; v < points.size(); ++v) {
+        if(pointTriangle[v]>=0){
+            ids.push_back(v);
+        }
+    }
+
+    return ids;
+}
+
+Mesh<Polygon> IncrementalVoronoiGenerator::getMesh() {
+    UniqueList<Point> meshPoints;
+    std::vector<int> newIndex(voronoiPoints.size(), -1);
+    std::vector<Polygon> polygons;
+    SegmentMap* segments = new SegmentMap;
+    PointMap* pointMap = new PointMap;
+
+    for(int id: getCellIds()){
+        std::vector<int> cell;
+        for(int i: cells[id]){
+            if(newIndex[i]<0){
+                newIndex[i] = meshPoints.push_back(voronoiPoints[i]);
+            }
+            cell.push_back(newIndex[i]);
+        }
+
+        int cellIndex = (int) polygons.size();
+        polygons.push_back(Polygon(cell, meshPoints.getList(), false));
+
+        for (int j = 0; j < cell.size(); ++j) {
+            segments->insert(IndexSegment(cell[j], cell[(j+1)%cell.size()]), cellIndex);
+            pointMap->insert(meshPoints[cell[j]], cellIndex);
+        }
+    }
+
+    return Mesh<Polygon>(meshPoints, polygons, segments, pointMap);
+}
@@ -0,0 +1,88 @@
+#include <delynoi/voronoi/LloydRelaxation.h>
+#include <delynoi/utilities/parallel.h>
+#include <delynoi/utilities/delynoi_utilities.h>
+#include <utilities/Profiler.h>
+#include <algorithm>
+
+LloydRelaxation::LloydRelaxation(int maxIterations, double tolerance) {
+    if(maxIterations<0 || tolerance<0){
+        throw std::invalid_argument("The number of iterations and the tolerance of the relaxation must be positive");
+    }
+
+    this->maxIterations = maxIterations;
+    this->tolerance = tolerance;
+}
+
+Mesh<Polygon> LloydRelaxation::relax(Region &region) {
+    PROFILE_PHASE("lloyd relaxation");
+
+    std::vector<Point> seeds = region.getSeedPoints();
+    IncrementalVoronoiGenerator generator(seeds, region);
+
+    this->iterations = 0;
+    this->displacement = 0;
+
+    while(this->iterations < this->maxIterations){
+        std::vector<int> ids;
+        for(int id: generator.getCellIds()){
+            if(!generator.getSeed(id).isInBoundary()){
+                ids.push_back(id);
+            }
+        }
+
+        // Cells are not modified while the centroids are computed, so each thread can read them
+        std::vector<Point> centroids(ids.size());
+        delynoi_utilities::parallelFor((int) ids.size(), delynoi_utilities::numberOfThreads(),
+                                       [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                std::vector<Point> cellPoints = generator.getCellPoints(ids[i]);
+                centroids[i] = Polygon(cellPoints).getCentroid(cellPoints);
+            }
+        });
+
+        std::vector<int> moved;
+        std::vector<Point> positions, previous;
+        for (int i = 0; i < ids.size(); ++i) {
+            Point seed = generator.getSeed(ids[i]);
+            if(delynoi_utilities::norm(seed - centroids[i]) > this->tolerance){
+                moved.push_back(ids[i]);
+                positions.push_back(centroids[i]);
+                previous.push_back(seed);
+            }
+        }
+
+        // Centroids of non convex cells (next to concave corners of the domain) can fall outside of it, and those
+        // seeds are left in place
+        VoronoiUpdate update = generator.move(moved, positions, true);
+        if(update.skippedCells.size()==moved.size()){
+            break;
+        }
+
+        this->displacement = 0;
+        for (int i = 0; i < moved.size(); ++i) {
+            if(!std::binary_search(update.skippedCells.begin(), update.skippedCells.end(), moved[i])){
+                this->displacement = std::max(this->displacement, delynoi_utilities::norm(previous[i] - positions[i]));
+            }
+        }
+
+        this->iterations++;
+    }
+
+    std::vector<Point> relaxed;
+    for(int id: generator.getCellIds()){
+        if(!generator.getSeed(id).isInBoundary()){
+            relaxed.push_back(generator.getSeed(id));
+        }
+    }
+    region.addSeedPoints(relaxed);
+
+    return generator.getMesh();
+}
+
+int LloydRelaxation::getIterations() {
+    return this->iterations;
+}
+
+double LloydRelaxation::getDisplacement() {
+    return this->displacement;
+}
@@ -1,9 +1,9 @@
 #include "delynoi/voronoi/TriangleDelaunayGenerator.h"
+#include <utilities/Profiler.h>
 
 TriangleDelaunayGenerator::TriangleDelaunayGenerator(const std::vector<Point>& points, Region region) {
     this->region = region;
     this->seedPoints = points;
-    this->delaunayEdges = new SegmentMap;
 }
 
 void TriangleDelaunayGenerator::callTriangle(std::vector<Point> &point_list, char *switches) {
@@ -13,9 +13,10 @@ void TriangleDelaunayGenerator::callTriangle(std::vector<Point> &point_list, cha
 
 void TriangleDelaunayGenerator::callTriangle(std::vector<Point> &point_list, char *switches,
                                              std::vector<PointSegment> restrictedSegments) {
+    PROFILE_PHASE("delaunay");
 
     this->empty = true;
-    struct triangulateio in, out;
+    struct triangulateio in, out = triangulateio();
 
     std::vector<Point> regionPoints = region.getRegionPoints();
     UniqueList<Point> pointList;
@@ -67,83 +68,55 @@ void TriangleDelaunayGenerator::callTriangle(std::vector<Point> &point_list, cha
 
     in.numberofregions = 0;
 
-    out.pointlist = (REAL *) NULL;
-    out.pointattributelist = (REAL *) NULL;
-    out.pointmarkerlist = (int *) NULL;
-    out.trianglelist = (int *) NULL;
-    out.triangleattributelist = (REAL *) NULL;
-    out.segmentmarkerlist = (int *) NULL;
-    out.segmentlist = (int *) NULL;
-    out.edgelist = (int *) NULL;
-    out.edgemarkerlist = (int *) NULL;
-
     triangulate(switches, &in, &out, (struct triangulateio *)NULL);
+    PROFILE_COUNTER("delaunay", "points", out.numberofpoints);
+    PROFILE_COUNTER("delaunay", "triangles", out.numberoftriangles);
 
-    for(int i=0;i<out.numberofpoints;i++){
-        PointData data (i);
-        this->points.push_back(data);
-        this->meshPoints.push_back(Point(out.pointlist[i*2], out.pointlist[i*2+1]));
-        if(out.pointmarkerlist[i]==1){
-            this->meshPoints.back().setBoundary();
-        }
-    }
-
-    for(int i=0;i<out.numberofedges;i++) {
-        EdgeData data(out.edgelist[2*i], out.edgelist[2*i+1]);
-        this->edges.push_back(data);
-        edgeMap.insert(std::make_pair(Key(out.edgelist[2*i], out.edgelist[2*i+1]),i));
-        this->points[out.edgelist[2*i]].setEdge(i, out.edgemarkerlist[i]);
-        this->points[out.edgelist[2*i+1]].setEdge(i, out.edgemarkerlist[i]);
-    }
-
-    for(int i=0;i<out.numberoftriangles;i++){
-        std::vector<int> triangle_points = {out.trianglelist[3*i], out.trianglelist[3*i+1],
-                                            out.trianglelist[3*i+2]};
-        realPoints.push_back(out.trianglelist[3*i]);
-        realPoints.push_back(out.trianglelist[3*i+1]);
-        realPoints.push_back(out.trianglelist[3*i+2]);
-
-        Triangle triangle (triangle_points, this->meshPoints, this->circumcenters);
-        int i1 = edgeMap[Key(out.trianglelist[3*i], out.trianglelist[3*i+1])];
-        int i2 = edgeMap[Key(out.trianglelist[3*i+1], out.trianglelist[3*i+2])];
-        int i3 = edgeMap[Key(out.trianglelist[3*i+2], out.trianglelist[3*i])];
+    free(in.pointlist);
+    free(in.pointattributelist);
+    free(in.pointmarkerlist);
+    free(in.segmentlist);
+    free(in.segmentmarkerlist);
+    free(in.holelist);
 
-        this->edges[i1].setTriangle(i);
-        this->edges[i2].setTriangle(i);
-        this->edges[i3].setTriangle(i);
+    // The output arrays are used in place; the neighbours given by Triangle relate edges and triangles
+    this->triangulation = std::make_shared<TriangulationData>(out);
+    TriangulationData& triangulation = *this->triangulation;
 
-        this->triangles.push_back(triangle);
+    this->points.reserve(triangulation.numberOfPoints());
+    this->meshPoints.reserve(triangulation.numberOfPoints());
+    for(int i=0;i<triangulation.numberOfPoints();i++){
+        this->points.push_back(PointData(i));
+        this->meshPoints.push_back(triangulation.getPoint(i));
     }
 
-    for (int i = 0; i < edges.size(); ++i) {
-        EdgeData data = edges[i];
-        IndexSegment segment (data.p1, data.p2);
-        NeighboursBySegment neighbours(data.t1, data.t2);
+    this->edges.reserve(triangulation.numberOfEdges());
+    for(int i=0;i<triangulation.numberOfEdges();i++) {
+        EdgeData data(triangulation.edgeFirst(i), triangulation.edgeSecond(i));
+        data.t1 = triangulation.edgeTriangle(i, 0);
+        data.t2 = triangulation.edgeTriangle(i, 1);
 
-        this->delaunayEdges->insert(segment, neighbours);
+        this->edges.push_back(data);
+        this->points[data.p1].setEdge(i, triangulation.edgeMarker(i));
+        this->points[data.p2].setEdge(i, triangulation.edgeMarker(i));
     }
 
-    free(in.pointlist);
-    free(in.pointattributelist);
-    free(in.pointmarkerlist);
-    free(in.segmentlist);
-    free(in.segmentmarkerlist);
-    free(in.holelist);
+    this->circumcenterIndexes.reserve(triangulation.numberOfTriangles());
+    for(int i=0;i<triangulation.numberOfTriangles();i++){
+        int a = triangulation.triangleVertex(i, 0), b = triangulation.triangleVertex(i, 1),
+                c = triangulation.triangleVertex(i, 2);
+        realPoints.push_back(a);
+        realPoints.push_back(b);
+        realPoints.push_back(c);
 
-    free(out.pointlist);
-    free(out.pointattributelist);
-    free(out.pointmarkerlist);
-    free(out.trianglelist);
-    free(out.triangleattributelist);
-    free(out.segmentmarkerlist);
-    free(out.segmentlist);
-    free(out.edgelist);
-    free(out.edgemarkerlist);
+        Point circumcenter = geometry_functions::circumcenter(meshPoints[a], meshPoints[b], meshPoints[c]);
+        this->circumcenterIndexes.push_back(this->circumcenters.push_back(circumcenter));
+    }
 }
 
 Mesh<Triangle> TriangleDelaunayGenerator::getConformingDelaunayTriangulation()  {
     if(!this->empty){
-        char switches[] = "pzejDQ";
+        char switches[] = "pzejnDQ";
         callTriangle(seedPoints, switches);
     }
 
@@ -184,16 +157,16 @@ TriangleDelaunayGenerator::writeTriangleInputFile(UniqueList<Point> &point_list,
 
 DelaunayInfo TriangleDelaunayGenerator::getConformingDelaunay() {
     if(!this->empty){
-        char switches[] = "pzejDQ";
+        char switches[] = "pzejnDQ";
         callTriangle(seedPoints, switches);
     }
 
-    return DelaunayInfo(triangles, meshPoints, delaunayEdges, points, realPoints, edges, edgeMap, circumcenters);
+    return DelaunayInfo(triangulation, meshPoints, points, realPoints, edges, circumcenters, circumcenterIndexes);
 }
 
 Mesh<Triangle> TriangleDelaunayGenerator::getConstrainedDelaunayTriangulation() {
     if(!this->empty){
-        char switches[] = "pzejQ";
+        char switches[] = "pzejnQ";
         callTriangle(seedPoints, switches);
     }
 
@@ -203,7 +176,7 @@ Mesh<Triangle> TriangleDelaunayGenerator::getConstrainedDelaunayTriangulation()
 Mesh<Triangle>
 TriangleDelaunayGenerator::getConstrainedDelaunayTriangulation(std::vector<PointSegment> restrictedSegments) {
     if(!this->empty){
-        char switches[] = "pzejQ";
+        char switches[] = "pzejnQ";
         callTriangle(seedPoints, switches, restrictedSegments);
     }
 
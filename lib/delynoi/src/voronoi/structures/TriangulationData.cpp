@@ -0,0 +1,134 @@
+#include <delynoi/voronoi/structures/TriangulationData.h>
+#include <cstdlib>
+#include <stdexcept>
+
+TriangulationData::TriangulationData(struct triangulateio &out) {
+    this->data = out;
+
+    // The hole and region lists are copied from the input, and the area list is input only
+    this->data.holelist = (REAL*) NULL;
+    this->data.regionlist = (REAL*) NULL;
+    this->data.trianglearealist = (REAL*) NULL;
+
+    out.pointlist = (REAL*) NULL;
+    out.pointattributelist = (REAL*) NULL;
+    out.pointmarkerlist = (int*) NULL;
+    out.trianglelist = (int*) NULL;
+    out.triangleattributelist = (REAL*) NULL;
+    out.neighborlist = (int*) NULL;
+    out.segmentlist = (int*) NULL;
+    out.segmentmarkerlist = (int*) NULL;
+    out.edgelist = (int*) NULL;
+    out.edgemarkerlist = (int*) NULL;
+    out.normlist = (REAL*) NULL;
+
+    // The destructor is not run if the constructor throws, so the arrays taken from out are freed here
+    try{
+        buildEdges();
+    }catch(...){
+        release();
+        throw;
+    }
+}
+
+void TriangulationData::buildEdges() {
+    if(data.numberoftriangles>0 && (data.neighborlist==NULL || data.edgelist==NULL)){
+        throw std::invalid_argument("Triangle must be called with the edges and neighbours switches");
+    }
+
+    // Edges incident to each point, in compressed form, to find the index of the edges of the triangles
+    std::vector<int> offsets(data.numberofpoints + 1, 0);
+    for (int e = 0; e < data.numberofedges; ++e) {
+        offsets[edgeFirst(e) + 1]++;
+        offsets[edgeSecond(e) + 1]++;
+    }
+    for (int i = 0; i < data.numberofpoints; ++i) {
+        offsets[i + 1] += offsets[i];
+    }
+
+    std::vector<int> incidentEdges(offsets.back());
+    std::vector<int> next(offsets.begin(), offsets.end() - 1);
+    for (int e = 0; e < data.numberofedges; ++e) {
+        incidentEdges[next[edgeFirst(e)]++] = e;
+        incidentEdges[next[edgeSecond(e)]++] = e;
+    }
+
+    // Each edge is found once, from its triangle with the lowest index, and set to the neighbour through the
+    // neighbours list
+    this->triangleEdges.assign(3*data.numberoftriangles, -1);
+    this->edgeTriangles.assign(2*data.numberofedges, -1);
+
+    for (int t = 0; t < data.numberoftriangles; ++t) {
+        for (int k = 0; k < 3; ++k) {
+            int n = neighbour(t, k);
+            if(n>=0 && n<t){
+                continue;
+            }
+
+            int a = triangleVertex(t, (k+1)%3), b = triangleVertex(t, (k+2)%3);
+            int edge = -1;
+            for (int j = offsets[a]; j < offsets[a+1]; ++j) {
+                int e = incidentEdges[j];
+                if(edgeFirst(e)==b || edgeSecond(e)==b){
+                    edge = e;
+                    break;
+                }
+            }
+
+            if(edge<0){
+                throw std::runtime_error("Edge of the triangulation not found in Triangle's edge list");
+            }
+
+            triangleEdges[3*t+k] = edge;
+            edgeTriangles[2*edge] = t;
+            edgeTriangles[2*edge+1] = n;
+
+            if(n>=0){
+                for (int j = 0; j < 3; ++j) {
+                    if(neighbour(n, j)==t){
+                        triangleEdges[3*n+j] = edge;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TriangulationData::~TriangulationData() {
+    release();
+}
+
+void TriangulationData::release() {
+    free(data.pointlist);
+    free(data.pointattributelist);
+    free(data.pointmarkerlist);
+    free(data.trianglelist);
+    free(data.triangleattributelist);
+    free(data.neighborlist);
+    free(data.segmentlist);
+    free(data.segmentmarkerlist);
+    free(data.edgelist);
+    free(data.edgemarkerlist);
+    free(data.normlist);
+}
+
+Point TriangulationData::getPoint(int i) const {
+    Point p(getX(i), getY(i));
+    if(isBoundaryPoint(i)){
+        p.setBoundary();
+    }
+
+    return p;
+}
+
+int TriangulationData::nextEdge(int t, int center, int edge) const {
+    // The edge opposite to a vertex contains the center if and only if the vertex is not the center
+    for (int k = 0; k < 3; ++k) {
+        int e = triangleEdge(t, k);
+        if(e!=edge && triangleVertex(t, k)!=center){
+            return e;
+        }
+    }
+
+    return -1;
+}
@@ -0,0 +1,100 @@
+#ifndef UTILITIES_BUFFEREDWRITER_H
+#define UTILITIES_BUFFEREDWRITER_H
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+/*
+ * Output file wrapper that formats numbers directly into a large memory buffer and only touches the underlying
+ * stream when the buffer is full (or on flush/close), avoiding the per value stringstream and per line flush costs
+ * of the naive approach
+ */
+class BufferedWriter {
+private:
+    /*
+     * Underlying file stream
+     */
+    std::ofstream file;
+
+    /*
+     * Memory buffer and number of bytes of it currently in use
+     */
+    std::vector<char> buffer;
+    size_t used;
+
+    /* Makes sure there are at least n free bytes in the buffer, writing its contents to the file if necessary
+     * @param n number of bytes required
+     */
+    void reserve(size_t n);
+public:
+    /*
+     * Default size of the memory buffer (4 MB)
+     */
+    static const size_t DEFAULT_CAPACITY = 1 << 22;
+
+    /*
+     * Constructor. Opens the file, throwing an exception if it can not be created
+     * @param path complete path of the file to write
+     * @param binary whether the file is opened in binary mode
+     * @param capacity size in bytes of the memory buffer
+     */
+    BufferedWriter(std::string path, bool binary = false, size_t capacity = DEFAULT_CAPACITY);
+
+    /*
+     * Destructor. Flushes the remaining contents and closes the file
+     */
+    ~BufferedWriter();
+
+    /* Writes an integer in text form
+     * @param value integer to write
+     */
+    void write(int value);
+
+    /* Writes a double in text form, using the same format as the default std::ostream (six significant digits)
+     * @param value number to write
+     */
+    void write(double value);
+
+    /* Writes a double in text form using fixed notation (equivalent to std::fixed and std::setprecision)
+     * @param value number to write
+     * @param precision number of decimals
+     */
+    void writeFixed(double value, int precision);
+
+    /* Writes a string
+     * @param s string to write
+     */
+    void write(const std::string& s);
+
+    /* Writes a single character
+     * @param c character to write
+     */
+    void write(char c);
+
+    /* Writes a raw block of memory (for binary files)
+     * @param data pointer to the first byte
+     * @param bytes number of bytes to write
+     */
+    void writeRaw(const void* data, size_t bytes);
+
+    /* Writes the in memory representation of a value (for binary files)
+     * @param value value to write
+     */
+    template <typename T>
+    void writeBinary(const T& value){
+        writeRaw(&value, sizeof(T));
+    }
+
+    /*
+     * Writes the buffer contents to the file
+     */
+    void flush();
+
+    /*
+     * Flushes and closes the file
+     */
+    void close();
+};
+
+#endif
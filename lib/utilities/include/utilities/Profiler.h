@@ -0,0 +1,186 @@
+#ifndef UTILITIES_PROFILER_H
+#define UTILITIES_PROFILER_H
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Instrumentation of the library phases (seed generation, Delaunay, Voronoi conversion, DOF creation, assembly,
+ * factorization, norm integration, output, etc). It is only compiled in when VEAMY_INSTRUMENTATION is defined (CMake
+ * option VEAMY_INSTRUMENTATION); otherwise the PROFILE_* macros expand to nothing and the Profiler never records
+ * anything, so instrumented code has no overhead
+ */
+#ifdef VEAMY_INSTRUMENTATION
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+#define PROFILE_PHASE(name) ScopedPhase PROFILE_CONCAT(profile_phase_, __LINE__)(name)
+#define PROFILE_COUNTER(phase, counter, value) Profiler::instance()->addCounter(phase, counter, value)
+#define PROFILE_TIMER(timer, name) PhaseTimer timer(name)
+#define PROFILE_RESUME(timer) (timer).resume()
+#define PROFILE_PAUSE(timer) (timer).pause()
+#else
+#define PROFILE_PHASE(name)
+#define PROFILE_COUNTER(phase, counter, value)
+#define PROFILE_TIMER(timer, name)
+#define PROFILE_RESUME(timer)
+#define PROFILE_PAUSE(timer)
+#endif
+
+/*
+ * Information recorded for a single phase
+ */
+struct PhaseRecord {
+    /*
+     * Name of the phase
+     */
+    std::string name;
+
+    /*
+     * Accumulated wall time (in seconds) and number of times the phase was executed
+     */
+    double wallTime = 0;
+    long calls = 0;
+
+    /*
+     * Peak memory (resident set size, in bytes) of the process at the end of the phase
+     */
+    size_t peakMemory = 0;
+
+    /*
+     * Additional counters (nnz, fill-in, solver iterations, number of elements, etc), accumulated over all calls
+     */
+    std::vector<std::pair<std::string, long long>> counters;
+};
+
+/*
+ * Class that accumulates the phase records of the calling thread (each thread has its own instance, so problems
+ * solved concurrently are reported separately)
+ */
+class Profiler {
+private:
+    /*
+     * Phase records, in the order they were first executed, and index of each phase by name
+     */
+    std::vector<PhaseRecord> phases;
+    std::unordered_map<std::string, int> index;
+
+    /* Finds the record of a phase, creating it if necessary
+     * @param phase name of the phase
+     * @return record of the phase
+     */
+    PhaseRecord& getRecord(const std::string& phase);
+public:
+    /*
+     * @return the Profiler of the calling thread
+     */
+    static Profiler* instance();
+
+    /*
+     * @return peak resident memory of the process, in bytes (zero if it can not be determined)
+     */
+    static size_t peakMemory();
+
+    /* Records an execution of a phase
+     * @param phase name of the phase
+     * @param seconds wall time of the execution
+     */
+    void addTime(const std::string& phase, double seconds);
+
+    /* Adds a value to a counter of a phase
+     * @param phase name of the phase
+     * @param counter name of the counter
+     * @param value value to add
+     */
+    void addCounter(const std::string& phase, const std::string& counter, long long value);
+
+    /*
+     * @return all recorded phases
+     */
+    const std::vector<PhaseRecord>& getPhases() const;
+
+    /*
+     * Discards all records
+     */
+    void reset();
+
+    /* Prints the records as a table
+     * @param out stream where the table is printed
+     */
+    void printTable(std::ostream& out) const;
+
+    /* Prints the records in JSON format
+     * @param out stream where the records are printed
+     */
+    void printJSON(std::ostream& out) const;
+};
+
+/*
+ * Measures the wall time of a phase during its lifetime (used through the PROFILE_PHASE macro)
+ */
+class ScopedPhase {
+private:
+    const char* name;
+    std::chrono::steady_clock::time_point start;
+public:
+    /*
+     * Constructor. Starts the measurement
+     * @param name name of the phase (must be a string literal or outlive the scope)
+     */
+    ScopedPhase(const char* name);
+
+    /*
+     * Destructor. Records the measurement in the Profiler of the calling thread
+     */
+    ~ScopedPhase();
+};
+
+/*
+ * Accumulates the wall time of a phase that runs in many short intervals (for example, once per element inside a
+ * loop) and records it in the Profiler as a single execution, so the cost of recording is paid once instead of once
+ * per interval. Used through the PROFILE_TIMER, PROFILE_RESUME and PROFILE_PAUSE macros
+ */
+class PhaseTimer {
+private:
+    const char* name;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::duration elapsed;
+    bool used;
+public:
+    /*
+     * Constructor
+     * @param name name of the phase (must be a string literal or outlive the timer)
+     */
+    PhaseTimer(const char* name);
+
+    /*
+     * Copies only the name of the phase, so that time accumulated by a timer is never recorded twice
+     */
+    PhaseTimer(const PhaseTimer& other);
+    PhaseTimer& operator=(const PhaseTimer& other);
+
+    /*
+     * Destructor. Records the accumulated time, if any
+     */
+    ~PhaseTimer();
+
+    /*
+     * Starts an interval of the phase
+     */
+    void resume();
+
+    /*
+     * Ends the current interval and adds it to the accumulated time
+     */
+    void pause();
+
+    /*
+     * Records the accumulated time in the Profiler of the calling thread as one execution of the phase (nothing if
+     * the timer was not used since the last call) and restarts the accumulation
+     */
+    void flush();
+};
+
+#endif
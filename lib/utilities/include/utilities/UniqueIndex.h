@@ -0,0 +1,63 @@
+#ifndef UTILITIES_UNIQUEINDEX_H
+#define UTILITIES_UNIQUEINDEX_H
+
+#include <map>
+
+/*
+ * Lookup structure used by UniqueList to find the position of an element equivalent to a given one. The default
+ * implementation is an ordered map using the operator< of the elements; types whose equivalence can be answered faster
+ * (for example, points compared with a tolerance) can specialize this template, keeping the same interface
+ */
+template <class T>
+class UniqueIndex {
+private:
+    std::map<T,int> map;
+public:
+    /* Finds an element equivalent to the given one
+     * @param item element to look for
+     * @return index associated to the equivalent element, -1 if there is none
+     */
+    int find(const T& item) {
+        auto it = map.upper_bound(item);
+
+        if (it == map.begin() || (--it)->first < item) {
+            return -1;
+        }
+
+        return it->second;
+    }
+
+    /* Finds an element equivalent to the given one, registering the element with the given index if there is none
+     * @param item element to look for
+     * @param index index associated to the element if it is inserted
+     * @return index associated to the equivalent element, -1 if the element was inserted
+     */
+    int findOrInsert(const T& item, int index) {
+        auto it = map.upper_bound(item);
+
+        if (it == map.begin() || (--it)->first < item) {
+            map.insert(it, std::make_pair(item, index));
+            return -1;
+        }
+
+        return it->second;
+    }
+
+    /* Registers an element, even if an equivalent one was already registered (in which case, lookups keep returning
+     * the index of the first one)
+     * @param item element to register
+     * @param index index associated to the element
+     */
+    void insert(const T& item, int index) {
+        map.insert(std::make_pair(item, index));
+    }
+
+    /*
+     * Removes all registered elements
+     */
+    void clear() {
+        map.clear();
+    }
+};
+
+#endif
@@ -3,14 +3,22 @@
 
 #include <vector>
 #include <algorithm>
-#include <map>
 #include <utilities/utilities.h>
+#include <utilities/UniqueIndex.h>
 
+/*
+ * List that keeps a single copy of equivalent elements, with an index (UniqueIndex) to find them
+ */
 template <class T>
 class UniqueList {
 private:
     std::vector<T> list;
-    std::map<T,int> map;
+    UniqueIndex<T> index;
+
+    /*
+     * Registers again all the elements of the list in the index (used after elements are removed)
+     */
+    void rebuildIndex();
 public:
     UniqueList();
     UniqueList(const UniqueList<T>& other);
@@ -41,25 +49,25 @@ UniqueList<T>::UniqueList() {}
 template<class T>
 UniqueList<T>::UniqueList(const UniqueList<T> &other) {
     this->list = other.list;
-    this->map = other.map;
+    this->index = other.index;
 }
 
 template <class T>
 int UniqueList<T>::push_back(T& item) {
-    auto it = map.upper_bound(item);
+    int found = index.findOrInsert(item, (int) list.size());
 
-    if (it == map.begin() || (--it)->first < item) {
-        map.insert(it, std::make_pair(item, list.size()));
+    if (found < 0) {
         list.push_back(item);
 
         return (int) list.size()-1;
     }else{
-        return it->second;
+        return found;
     }
 }
 
 template <class T>
 int UniqueList<T>::force_push_back(T &item) {
+    index.insert(item, (int) list.size());
     list.push_back(item);
 
     return (int) list.size()-1;
@@ -67,10 +75,8 @@ int UniqueList<T>::force_push_back(T &item) {
 
 template <class T>
 void UniqueList<T>::pop_front() {
-    T elem = this->list[0];
-
     this->list.erase(this->list.begin());
-    this->map.erase(elem);
+    rebuildIndex();
 }
 
 template <class T>
@@ -85,7 +91,7 @@ std::vector<T> UniqueList<T>::getList() const{
 
 template <class T>
 int UniqueList<T>::indexOf(T elem) {
-    return utilities::indexOf(this->list, elem);
+    return index.find(elem);
 }
 
 template <class T>
@@ -122,8 +128,7 @@ std::vector<int> UniqueList<T>::push_list(UniqueList<T>& list) {
 
 template <class T>
 bool UniqueList<T>::contains(T elem) {
-    auto iter = map.find(elem);
-    return iter != map.end();
+    return index.find(elem) >= 0;
 }
 
 template <class T>
@@ -145,22 +150,26 @@ bool UniqueList<T>::hasCommonElement(UniqueList<T>& other) {
 template <class T>
 void UniqueList<T>::clear() {
     this->list.clear();
-    this->map.clear();
+    this->index.clear();
 }
 
 template <class T>
 void UniqueList<T>::delete_element(T item) {
-    if(!this->contains(item)){
+    int i = index.find(item);
+    if(i < 0){
         return;
     }
 
-    auto iter = map.find(item);
-    this->list.erase(this->list.begin() + iter->second);
-    this->map.clear();
+    this->list.erase(this->list.begin() + i);
+    rebuildIndex();
+}
+
+template <class T>
+void UniqueList<T>::rebuildIndex() {
+    this->index.clear();
 
     for (int i=0;i<this->list.size();i++){
-        T e = this->list[i];
-        map.insert(std::make_pair(e, i));
+        index.insert(this->list[i], i);
     }
 }
 
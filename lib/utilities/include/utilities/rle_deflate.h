@@ -0,0 +1,30 @@
+#ifndef UTILITIES_RLE_DEFLATE_H
+#define UTILITIES_RLE_DEFLATE_H
+
+#include <vector>
+#include <cstddef>
+
+/*
+ * Minimal run-length compressor that produces standard zlib (RFC 1950/1951) streams without depending on zlib. Only
+ * repetitions at a few short, fixed distances (1, 2, 4, 8, 12, 16, 24 and 32 bytes) are searched for, and the result
+ * is encoded with the fixed Huffman tables, so compression is fast and works well on the highly repetitive arrays
+ * produced when exporting meshes (cell types, zero components, equal values), while any zlib decompressor (for
+ * example, the one used by VTK/ParaView) can read it
+ */
+namespace rle_deflate{
+    /* Compresses a block of memory
+     * @param data pointer to the first byte
+     * @param n number of bytes
+     * @param out vector where the zlib stream is appended
+     */
+    extern void compress(const unsigned char* data, size_t n, std::vector<unsigned char>& out);
+
+    /* Computes the Adler-32 checksum of a block of memory
+     * @param data pointer to the first byte
+     * @param n number of bytes
+     * @return checksum
+     */
+    extern unsigned int adler32(const unsigned char* data, size_t n);
+}
+
+#endif
@@ -0,0 +1,94 @@
+#include <utilities/BufferedWriter.h>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+const size_t BufferedWriter::DEFAULT_CAPACITY;
+
+BufferedWriter::BufferedWriter(std::string path, bool binary, size_t capacity) {
+    std::ios::openmode mode = binary? std::ios::out | std::ios::binary : std::ios::out;
+    this->file.open(path, mode);
+
+    if(!this->file.good()){
+        throw std::runtime_error("Could not open file " + path + " for writing. Please check path.");
+    }
+
+    this->buffer.resize(capacity>0? capacity : 1);
+    this->used = 0;
+}
+
+BufferedWriter::~BufferedWriter() {
+    close();
+}
+
+void BufferedWriter::reserve(size_t n) {
+    if(this->used + n <= this->buffer.size()){
+        return;
+    }
+
+    flush();
+
+    if(n > this->buffer.size()){
+        this->buffer.resize(n);
+    }
+}
+
+void BufferedWriter::write(int value) {
+    reserve(16);
+    this->used += std::sprintf(&this->buffer[this->used], "%d", value);
+}
+
+void BufferedWriter::write(double value) {
+    reserve(32);
+    this->used += std::sprintf(&this->buffer[this->used], "%g", value);
+}
+
+void BufferedWriter::writeFixed(double value, int precision) {
+    size_t available = this->buffer.size() - this->used;
+    int n = std::snprintf(&this->buffer[this->used], available, "%.*f", precision, value);
+
+    if(n >= (int) available){
+        reserve((size_t) n + 1);
+        n = std::snprintf(&this->buffer[this->used], (size_t) n + 1, "%.*f", precision, value);
+    }
+
+    this->used += n;
+}
+
+void BufferedWriter::write(const std::string &s) {
+    writeRaw(s.data(), s.size());
+}
+
+void BufferedWriter::write(char c) {
+    reserve(1);
+    this->buffer[this->used++] = c;
+}
+
+void BufferedWriter::writeRaw(const void *data, size_t bytes) {
+    if(bytes >= this->buffer.size()){
+        flush();
+        this->file.write(static_cast<const char*>(data), bytes);
+        return;
+    }
+
+    reserve(bytes);
+    std::memcpy(&this->buffer[this->used], data, bytes);
+    this->used += bytes;
+}
+
+void BufferedWriter::flush() {
+    if(this->used > 0 && this->file.is_open()){
+        this->file.write(this->buffer.data(), this->used);
+    }
+
+    this->used = 0;
+}
+
+void BufferedWriter::close() {
+    if(!this->file.is_open()){
+        return;
+    }
+
+    flush();
+    this->file.close();
+}
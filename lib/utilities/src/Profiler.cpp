@@ -0,0 +1,163 @@
+#include <utilities/Profiler.h>
+#include <algorithm>
+#include <iomanip>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+Profiler* Profiler::instance() {
+    static thread_local Profiler profiler;
+    return &profiler;
+}
+
+size_t Profiler::peakMemory() {
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage)!=0){
+        return 0;
+    }
+
+#if defined(__APPLE__)
+    return (size_t) usage.ru_maxrss;
+#else
+    return (size_t) usage.ru_maxrss*1024;
+#endif
+#else
+    return 0;
+#endif
+}
+
+PhaseRecord& Profiler::getRecord(const std::string &phase) {
+    auto found = index.find(phase);
+    if(found!=index.end()){
+        return phases[found->second];
+    }
+
+    index[phase] = (int) phases.size();
+    phases.push_back(PhaseRecord());
+    phases.back().name = phase;
+
+    return phases.back();
+}
+
+void Profiler::addTime(const std::string &phase, double seconds) {
+    PhaseRecord& record = getRecord(phase);
+    record.wallTime += seconds;
+    record.calls++;
+    record.peakMemory = std::max(record.peakMemory, peakMemory());
+}
+
+void Profiler::addCounter(const std::string &phase, const std::string &counter, long long value) {
+    PhaseRecord& record = getRecord(phase);
+
+    for(std::pair<std::string,long long>& c: record.counters){
+        if(c.first==counter){
+            c.second += value;
+            return;
+        }
+    }
+
+    record.counters.push_back(std::make_pair(counter, value));
+}
+
+const std::vector<PhaseRecord>& Profiler::getPhases() const {
+    return this->phases;
+}
+
+void Profiler::reset() {
+    this->phases.clear();
+    this->index.clear();
+}
+
+void Profiler::printTable(std::ostream &out) const {
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
+    out << std::left << std::setw(24) << "phase" << std::right << std::setw(10) << "calls"
+        << std::setw(14) << "time[s]" << std::setw(14) << "peak[MB]" << "  counters" << '\n';
+
+    for(const PhaseRecord& r: phases){
+        out << std::left << std::setw(24) << r.name << std::right << std::setw(10) << r.calls
+            << std::fixed << std::setprecision(6) << std::setw(14) << r.wallTime
+            << std::setprecision(1) << std::setw(14) << r.peakMemory/(1024.0*1024.0) << ' ';
+
+        for(const std::pair<std::string,long long>& c: r.counters){
+            out << ' ' << c.first << '=' << c.second;
+        }
+        out << '\n';
+
+        out.flags(flags);
+        out.precision(precision);
+    }
+
+    out.flush();
+}
+
+void Profiler::printJSON(std::ostream &out) const {
+    std::streamsize precision = out.precision(9);
+
+    out << "{\"phases\": [";
+    for (int i = 0; i < phases.size(); ++i) {
+        const PhaseRecord& r = phases[i];
+
+        out << (i>0? ", " : "") << "{\"name\": \"" << r.name << "\", \"calls\": " << r.calls
+            << ", \"time\": " << r.wallTime << ", \"peak_memory\": " << r.peakMemory << ", \"counters\": {";
+
+        for (int j = 0; j < r.counters.size(); ++j) {
+            out << (j>0? ", " : "") << '"' << r.counters[j].first << "\": " << r.counters[j].second;
+        }
+        out << "}}";
+    }
+    out << "]}" << std::endl;
+
+    out.precision(precision);
+}
+
+ScopedPhase::ScopedPhase(const char *name) {
+    this->name = name;
+    this->start = std::chrono::steady_clock::now();
+}
+
+ScopedPhase::~ScopedPhase() {
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    Profiler::instance()->addTime(name, elapsed.count());
+}
+
+PhaseTimer::PhaseTimer(const char *name) {
+    this->name = name;
+    this->elapsed = std::chrono::steady_clock::duration::zero();
+    this->used = false;
+}
+
+PhaseTimer::PhaseTimer(const PhaseTimer &other) : PhaseTimer(other.name) {}
+
+PhaseTimer& PhaseTimer::operator=(const PhaseTimer &other) {
+    flush();
+    this->name = other.name;
+
+    return *this;
+}
+
+PhaseTimer::~PhaseTimer() {
+    flush();
+}
+
+void PhaseTimer::resume() {
+    this->start = std::chrono::steady_clock::now();
+    this->used = true;
+}
+
+void PhaseTimer::pause() {
+    this->elapsed += std::chrono::steady_clock::now() - start;
+}
+
+void PhaseTimer::flush() {
+    if(!used){
+        return;
+    }
+
+    Profiler::instance()->addTime(name, std::chrono::duration<double>(elapsed).count());
+    this->elapsed = std::chrono::steady_clock::duration::zero();
+    this->used = false;
+}
@@ -0,0 +1,156 @@
+#include <utilities/rle_deflate.h>
+
+namespace rle_deflate{
+    namespace {
+        const int LENGTH_BASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83,
+                                     99, 115, 131, 163, 195, 227, 258};
+        const int LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5,
+                                      5, 5, 0};
+        const int DISTANCE_BASE[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769,
+                                       1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+        const int DISTANCE_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11,
+                                        11, 12, 12, 13, 13};
+
+        const int DISTANCES[8] = {1, 2, 4, 8, 12, 16, 24, 32};
+        const int MIN_MATCH = 3;
+        const int MAX_MATCH = 258;
+
+        /*
+         * Writes bits least significant first, as required by deflate
+         */
+        class BitWriter {
+        private:
+            std::vector<unsigned char>& out;
+            unsigned long long buffer;
+            int count;
+        public:
+            BitWriter(std::vector<unsigned char>& out) : out(out), buffer(0), count(0) {}
+
+            void bits(unsigned int value, int n){
+                buffer |= ((unsigned long long) value) << count;
+                count += n;
+
+                while(count >= 8){
+                    out.push_back((unsigned char) (buffer & 0xFF));
+                    buffer >>= 8;
+                    count -= 8;
+                }
+            }
+
+            // Huffman codes are stored most significant bit first
+            void code(unsigned int value, int n){
+                unsigned int reversed = 0;
+                for (int i = 0; i < n; ++i) {
+                    reversed = (reversed << 1) | ((value >> i) & 1);
+                }
+
+                bits(reversed, n);
+            }
+
+            void symbol(int s){
+                if(s < 144){
+                    code(0x30 + s, 8);
+                }else if(s < 256){
+                    code(0x190 + s - 144, 9);
+                }else if(s < 280){
+                    code(s - 256, 7);
+                }else{
+                    code(0xC0 + s - 280, 8);
+                }
+            }
+
+            void match(int length, int distance){
+                int i = 28;
+                while(LENGTH_BASE[i] > length){
+                    i--;
+                }
+                symbol(257 + i);
+                bits(length - LENGTH_BASE[i], LENGTH_EXTRA[i]);
+
+                int j = 29;
+                while(DISTANCE_BASE[j] > distance){
+                    j--;
+                }
+                code(j, 5);
+                bits(distance - DISTANCE_BASE[j], DISTANCE_EXTRA[j]);
+            }
+
+            void align(){
+                if(count > 0){
+                    bits(0, 8 - count);
+                }
+            }
+        };
+    }
+
+    unsigned int adler32(const unsigned char *data, size_t n) {
+        const unsigned int MOD = 65521;
+        unsigned int a = 1, b = 0;
+
+        while(n > 0){
+            size_t chunk = n < 5552? n : 5552;
+            n -= chunk;
+
+            for (size_t i = 0; i < chunk; ++i) {
+                a += *data++;
+                b += a;
+            }
+
+            a %= MOD;
+            b %= MOD;
+        }
+
+        return (b << 16) | a;
+    }
+
+    void compress(const unsigned char *data, size_t n, std::vector<unsigned char> &out) {
+        out.push_back(0x78);
+        out.push_back(0x01);
+
+        BitWriter writer(out);
+        writer.bits(1, 1);
+        writer.bits(1, 2);
+
+        size_t i = 0;
+        while(i < n){
+            int bestLength = 0, bestDistance = 0;
+            size_t limit = n - i < MAX_MATCH? n - i : MAX_MATCH;
+
+            for(int d: DISTANCES){
+                if((size_t) d > i){
+                    break;
+                }
+
+                const unsigned char* current = data + i;
+                const unsigned char* previous = current - d;
+
+                size_t length = 0;
+                while(length < limit && current[length]==previous[length]){
+                    length++;
+                }
+
+                if((int) length > bestLength){
+                    bestLength = (int) length;
+                    bestDistance = d;
+                }
+            }
+
+            if(bestLength >= MIN_MATCH){
+                writer.match(bestLength, bestDistance);
+                i += bestLength;
+            }else{
+                writer.symbol(data[i]);
+                i++;
+            }
+        }
+
+        writer.symbol(256);
+        writer.align();
+
+        unsigned int checksum = adler32(data, n);
+        out.push_back((unsigned char) (checksum >> 24));
+        out.push_back((unsigned char) ((checksum >> 16) & 0xFF));
+        out.push_back((unsigned char) ((checksum >> 8) & 0xFF));
+        out.push_back((unsigned char) (checksum & 0xFF));
+    }
+}
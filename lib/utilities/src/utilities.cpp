@@ -24,8 +24,8 @@ namespace utilities {
     }
 
     int random_integer(int min, int max){
-        static std::random_device rd;
-        static std::mt19937 rng (rd());
+        static thread_local std::random_device rd;
+        static thread_local std::mt19937 rng (rd());
         std::uniform_int_distribution<int> uni(min,max);
 
         return uni(rng);
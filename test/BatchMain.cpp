@@ -0,0 +1,137 @@
+//**************************************************************
+// Convergence study of the cantilever beam subjected to a
+// parabolic end load, solving all meshes (VEM and FEM) in
+// parallel using the batch runner
+//**************************************************************
+
+#include <delynoi/models/basic/Point.h>
+#include <delynoi/models/Region.h>
+#include <delynoi/models/generator/functions/functions.h>
+#include <veamy/models/constraints/values/Function.h>
+#include <veamy/physics/materials/MaterialPlaneStrain.h>
+#include <veamy/physics/conditions/LinearElasticityConditions.h>
+#include <veamy/batch/BatchRunner.h>
+#include <utilities/utilities.h>
+#include <iostream>
+#include <cstdlib>
+
+double tangencial(double x, double y){
+    double P = -1000;
+    double D =  4;
+    double I = std::pow(D,3)/12;
+    double value = std::pow(D,2)/4-std::pow(y,2);
+    return P/(2*I)*value;
+}
+
+double uX(double x, double y){
+    double P = -1000;
+    double Ebar = 1e7/(1 - std::pow(0.3,2));
+    double vBar = 0.3/(1 - 0.3);
+    double D = 4;
+    double L = 8;
+    double I = std::pow(D,3)/12;
+    return -P*y/(6*Ebar*I)*((6*L - 3*x)*x + (2+vBar)*std::pow(y,2) - 3*std::pow(D,2)/2*(1+vBar));
+}
+
+double uY(double x, double y){
+    double P = -1000;
+    double Ebar = 1e7/(1 - std::pow(0.3,2));
+    double vBar = 0.3/(1 - 0.3);
+    double D = 4;
+    double L = 8;
+    double I = std::pow(D,3)/12;
+    return P/(6*Ebar*I)*(3*vBar*std::pow(y,2)*(L-x) + (3*L-x)*std::pow(x,2));
+}
+
+std::vector<double> exactDisplacement(double x, double y){
+    return {uX(x,y), uY(x,y)};
+}
+
+// Feamy uses the engineering shear strain, while Veamy uses the tensorial one
+std::vector<double> exactStrain(double x, double y, bool engineeringShear){
+    double P = -1000;
+    double Ebar = 1e7/(1 - std::pow(0.3,2));
+    double vBar = 0.3/(1 - 0.3);
+    double D = 4;
+    double L = 8;
+    double I = std::pow(D,3)/12;
+    double duxdx = -(P*y*(6*L-6*x))/(6*Ebar*I);
+    double duydx = -(P*(3*vBar*std::pow(y,2)-2*x*(3*L-x)+std::pow(x,2)))/(6*Ebar*I);
+    double duxdy = -(P*((vBar+2)*std::pow(y,2)+x*(6*L-3*x)-(3*std::pow(D,2)*(vBar+1))/2))/(6*Ebar*I)-(P*std::pow(y,2)*(vBar+2))/(3*Ebar*I);
+    double duydy = (P*vBar*y*(L-x))/(Ebar*I);
+
+    double shear = engineeringShear? duxdy+duydx : 0.5*(duxdy+duydx);
+
+    return {duxdx,duydy,shear};
+}
+
+std::vector<double> exactStrainVEM(double x, double y){
+    return exactStrain(x, y, false);
+}
+
+std::vector<double> exactStrainFEM(double x, double y){
+    return exactStrain(x, y, true);
+}
+
+int main(int argc, char** argv){
+    // Usage: Batch [number of threads] [memory budget in MB]
+    // Zero (or omitting the argument) uses one thread per core and no memory limit.
+    int threads = argc > 1? std::atoi(argv[1]) : 0;
+    size_t budget = argc > 2? (size_t) std::atol(argv[2])*1024*1024 : 0;
+
+    std::vector<Point> rectangle4x8_points = {Point(0, -2), Point(8, -2), Point(8, 2), Point(0, 2)};
+    Region rectangle4x8(rectangle4x8_points);
+
+    Material* material = new MaterialPlaneStrain(1e7, 0.3);
+    Function* uXConstraint = new Function(uX);
+    Function* uYConstraint = new Function(uY);
+    Function* tangencialLoad = new Function(tangencial);
+    DisplacementValue* exactDisplacementSolution = new DisplacementValue(exactDisplacement);
+    StrainValue* exactStrainVEMSolution = new StrainValue(exactStrainVEM);
+    StrainValue* exactStrainFEMSolution = new StrainValue(exactStrainFEM);
+
+    auto constraints = [=](LinearElasticityConditions* conditions, UniqueList<Point>& points) {
+        PointSegment leftSide(Point(0,-2), Point(0,2));
+        SegmentConstraint const1 (leftSide, points, uXConstraint);
+        conditions->addEssentialConstraint(const1, points, elasticity_constraints::Direction::Horizontal);
+
+        SegmentConstraint const2 (leftSide, points, uYConstraint);
+        conditions->addEssentialConstraint(const2, points, elasticity_constraints::Direction::Vertical);
+
+        PointSegment rightSide(Point(8,-2), Point(8,2));
+        SegmentConstraint const3 (rightSide, points, tangencialLoad);
+        conditions->addNaturalConstraint(const3, points, elasticity_constraints::Direction::Vertical);
+    };
+
+    std::vector<ProblemSpecification> problems;
+    int sizes[] = {4, 8, 12, 16, 24, 32};
+
+    for(BatchMethod method: {BatchMethod::VEM, BatchMethod::FEM}){
+        for(int n: sizes){
+            ProblemSpecification spec;
+            spec.name = std::string(method==BatchMethod::VEM? "vem_" : "fem_") + utilities::toString(2*n) + "x" +
+                        utilities::toString(n);
+            spec.method = method;
+            spec.region = &rectangle4x8;
+            // ConstantAlternating keeps state between calls, so each problem needs its own generator
+            spec.generator = new PointGenerator(functions::constantAlternating(), functions::constant());
+            spec.nX = 2*n;
+            spec.nY = n;
+            spec.material = material;
+            spec.constraints = constraints;
+            spec.exactDisplacement = exactDisplacementSolution;
+            spec.exactStrain = method==BatchMethod::VEM? exactStrainVEMSolution : exactStrainFEMSolution;
+
+            problems.push_back(spec);
+        }
+    }
+
+    std::cout << "*** Starting Veamy batch ***" << std::endl;
+    std::cout << "--> Convergence study: cantilever beam subjected to a parabolic end load <--" << std::endl;
+
+    BatchRunner runner(threads, budget);
+    std::vector<BatchResult> results = runner.run(problems);
+
+    BatchRunner::printTable(results, std::cout);
+    std::cout << "*** Veamy batch has ended ***" << std::endl;
+}
@@ -0,0 +1,387 @@
+//**************************************************************
+// Benchmark of the main phases of Veamy and Feamy (mesh
+// generation, initProblem, assemble, solve, computeErrorNorm
+// and file output) on scalable synthetic problems. Results are
+// printed as a table and saved in JSON format, so that runs of
+// different builds can be compared
+//**************************************************************
+
+#include <delynoi/models/Region.h>
+#include <delynoi/models/generator/functions/functions.h>
+#include <delynoi/voronoi/TriangleVoronoiGenerator.h>
+#include <delynoi/voronoi/TriangleDelaunayGenerator.h>
+#include <veamy/Veamer.h>
+#include <veamy/models/constraints/values/Function.h>
+#include <veamy/physics/materials/MaterialPlaneStrain.h>
+#include <veamy/physics/conditions/LinearElasticityConditions.h>
+#include <veamy/problems/VeamyLinearElasticityDiscretization.h>
+#include <veamy/postprocess/L2NormCalculator.h>
+#include <veamy/postprocess/H1NormCalculator.h>
+#include <feamy/Feamer.h>
+#include <feamy/models/constructor/Tri3Constructor.h>
+#include <feamy/problem/FeamyLinearElasticityDiscretization.h>
+#include <utilities/utilities.h>
+#include <utilities/Profiler.h>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+typedef std::chrono::high_resolution_clock clock_type;
+
+double secondsSince(clock_type::time_point start){
+    return std::chrono::duration_cast<std::chrono::microseconds>(clock_type::now() - start).count()/1e6;
+}
+
+// Linear displacement field imposed on the whole boundary (patch test), so the computed error norms also work as a
+// sanity check of each case
+double uXPatch(double x, double y){
+    return x;
+}
+
+double uYPatch(double x, double y){
+    return x + y;
+}
+
+std::vector<double> exactDisplacement(double x, double y){
+    return {x, x+y};
+}
+
+// Veamy uses the tensorial shear strain, Feamy the engineering one
+std::vector<double> exactStrainVEM(double x, double y){
+    return {1,1,0.5};
+}
+
+std::vector<double> exactStrainFEM(double x, double y){
+    return {1,1,1};
+}
+
+struct BenchmarkCase {
+    std::string name;
+    std::string method;
+    int elements = 0;
+    int points = 0;
+    int dofs = 0;
+
+    double meshTime = 0;
+    double initTime = 0;
+    double assembleTime = 0;
+    double solveTime = 0;
+    double normTime = -1;
+    double outputTime = 0;
+    double totalTime = 0;
+
+    double L2 = -1;
+    double H1 = -1;
+
+    std::string phases;
+};
+
+Region unitSquare(){
+    std::vector<Point> points = {Point(0,0), Point(1,0), Point(1,1), Point(0,1)};
+    return Region(points);
+}
+
+Region unicorn(){
+    std::vector<Point> points = {Point(2,0), Point(3,0.5), Point(3.5,2), Point(4,4), Point(6,4), Point(8.5,4),
+                                 Point(9,2), Point(9.5,0.5), Point(10,0), Point(10.5,0.5), Point(11.2,2.5),
+                                 Point(11.5,4.5), Point(11.8,8.75), Point(11.8,11.5), Point(13.5,11), Point(14.5,11.2),
+                                 Point(15,12), Point(15,13), Point(15,14.5), Point(14,16.5), Point(15,19.5), Point(15.2,20),
+                                 Point(14.5,19.7), Point(11.8,18.2), Point(10.5,18.3), Point(10,18), Point(8,16),
+                                 Point(7.3,15.3), Point(7,13.8), Point(6.7,11.5), Point(3.3,11.3), Point(1,10.5),
+                                 Point(0.4,8.8), Point(0.3,6.8), Point(0.4,4), Point(0.8,2.1), Point(1.3,0.4)};
+    return Region(points);
+}
+
+// Number of seeds in each axis so that about "cells" seeds fall inside the region
+int seedsPerAxis(Region& region, int cells){
+    BoundingBox box = region.getBox();
+    std::vector<Point> points = region.getRegionPoints();
+    double fill = region.getArea(points)/(box.getWidth()*box.getHeight());
+
+    return std::max(2, (int) std::ceil(std::sqrt(cells/fill)));
+}
+
+// Path of a file of the source tree relative to the user path, as input files are always read from there (empty if
+// the file is not inside the user path)
+std::string relativeToUserPath(std::string absolutePath){
+    std::string userPath = utilities::getPath();
+
+    if(absolutePath.compare(0, userPath.size(), userPath)!=0){
+        return "";
+    }
+
+    return absolutePath.substr(userPath.size());
+}
+
+template <typename T>
+void releaseMesh(Mesh<T>& mesh){
+    delete mesh.getSegments();
+    delete mesh.getPointMap();
+}
+
+// Imposes the patch test displacement on every mesh point of the boundary (Voronoi meshes do not necessarily keep
+// the vertices of non convex regions, so the constraints can not be defined on the region segments)
+void addPatchConstraints(LinearElasticityConditions* conditions, Region& region, UniqueList<Point>& points,
+                         Function* uX, Function* uY){
+    std::vector<Point> boundaryPoints;
+    for (int i = 0; i < points.size(); ++i) {
+        if(region.inEdges(points[i])){
+            boundaryPoints.push_back(points[i]);
+        }
+    }
+
+    PointConstraint constraintX(boundaryPoints, uX);
+    conditions->addEssentialConstraint(constraintX, elasticity_constraints::Direction::Horizontal);
+
+    PointConstraint constraintY(boundaryPoints, uY);
+    conditions->addEssentialConstraint(constraintY, elasticity_constraints::Direction::Vertical);
+}
+
+// Phases common to Veamy and Feamy, once the problem is initialized
+template <typename T, typename Calculator>
+void measureSolution(Calculator& calculator, Mesh<T>& mesh, StrainValue* exactStrain, BenchmarkCase& result){
+    result.elements = mesh.getPolygons().size();
+    result.points = mesh.getPoints().size();
+    result.dofs = calculator.DOFs.size();
+
+    clock_type::time_point start = clock_type::now();
+    Eigen::MatrixXd K = Eigen::MatrixXd::Zero(result.dofs, result.dofs);
+    Eigen::VectorXd f = Eigen::VectorXd::Zero(result.dofs);
+    calculator.assemble(K, f);
+    result.assembleTime = secondsSince(start);
+
+    // Boundary conditions and solution of the system just assembled (simulate would assemble it again)
+    start = clock_type::now();
+    Eigen::VectorXd x = calculator.solve(K, f);
+    result.solveTime = secondsSince(start);
+
+    // The dense matrix is the largest structure of the problem, so it is freed before the norms are computed
+    K.resize(0, 0);
+
+    if(exactStrain!=nullptr){
+        DisplacementValue exactDisplacementSolution(exactDisplacement);
+
+        start = clock_type::now();
+        L2NormCalculator<T> L2(&exactDisplacementSolution, x, calculator.DOFs);
+        result.L2 = calculator.computeErrorNorm(&L2, mesh).NormValue;
+
+        H1NormCalculator<T> H1(exactStrain, x, calculator.DOFs);
+        result.H1 = calculator.computeErrorNorm(&H1, mesh).NormValue;
+        result.normTime = secondsSince(start);
+    }
+
+    start = clock_type::now();
+    mesh.printInFile("benchmark_mesh.txt");
+    calculator.writeDisplacements("benchmark_displacements.txt", x);
+    result.outputTime = secondsSince(start);
+}
+
+BenchmarkCase runVeamyGenerated(std::string name, Region region, int cells){
+    BenchmarkCase result;
+    result.name = name;
+    result.method = "VEM";
+
+    clock_type::time_point start = clock_type::now();
+    int n = seedsPerAxis(region, cells);
+    region.generateSeedPoints(PointGenerator(functions::constantAlternating(), functions::constant()), n, n);
+    std::vector<Point> seeds = region.getSeedPoints();
+    TriangleVoronoiGenerator generator(seeds, region);
+    Mesh<Polygon> mesh = generator.getMesh();
+    result.meshTime = secondsSince(start);
+
+    start = clock_type::now();
+    MaterialPlaneStrain material(1e7, 0.3);
+    LinearElasticityConditions conditions(&material);
+    Function uX(uXPatch), uY(uYPatch);
+    addPatchConstraints(&conditions, region, mesh.getPoints(), &uX, &uY);
+
+    VeamyLinearElasticityDiscretization problem(&conditions);
+    Veamer v(&problem);
+    v.initProblem(mesh);
+    result.initTime = secondsSince(start);
+
+    StrainValue exactStrain(exactStrainVEM);
+    measureSolution(v, mesh, &exactStrain, result);
+    releaseMesh(mesh);
+
+    return result;
+}
+
+BenchmarkCase runFeamyGenerated(std::string name, Region region, int cells){
+    BenchmarkCase result;
+    result.name = name;
+    result.method = "FEM";
+
+    // A Delaunay triangulation has about two triangles per seed
+    clock_type::time_point start = clock_type::now();
+    int n = seedsPerAxis(region, std::max(1, cells/2));
+    region.generateSeedPoints(PointGenerator(functions::constantAlternating(), functions::constant()), n, n);
+    std::vector<Point> seeds = region.getSeedPoints();
+    TriangleDelaunayGenerator generator(seeds, region);
+    Mesh<Triangle> mesh = generator.getConformingDelaunayTriangulation();
+    result.meshTime = secondsSince(start);
+
+    start = clock_type::now();
+    MaterialPlaneStrain material(1e7, 0.3);
+    LinearElasticityConditions conditions(&material);
+    Function uX(uXPatch), uY(uYPatch);
+    addPatchConstraints(&conditions, region, mesh.getPoints(), &uX, &uY);
+
+    FeamyLinearElasticityDiscretization problem(&conditions);
+    Tri3Constructor constructor;
+    Feamer f(&problem);
+    f.initProblem(mesh, &constructor);
+    result.initTime = secondsSince(start);
+
+    StrainValue exactStrain(exactStrainFEM);
+    measureSolution(f, mesh, &exactStrain, result);
+    releaseMesh(mesh);
+
+    return result;
+}
+
+// PolyMesher meshes carry their own boundary conditions and have no exact solution, so norms are skipped
+BenchmarkCase runPolyMesherImport(std::string name, std::string fileName){
+    if(fileName.empty()){
+        throw std::invalid_argument("the test files are not inside the user path");
+    }
+
+    BenchmarkCase result;
+    result.name = name;
+    result.method = "VEM";
+
+    clock_type::time_point start = clock_type::now();
+    MaterialPlaneStrain material(1e7, 0.3);
+    LinearElasticityConditions conditions(&material);
+    VeamyLinearElasticityDiscretization problem(&conditions);
+    Veamer v(&problem);
+    Mesh<Polygon> mesh = v.initProblemFromFile(fileName);
+    result.initTime = secondsSince(start);
+
+    measureSolution(v, mesh, nullptr, result);
+    releaseMesh(mesh);
+
+    return result;
+}
+
+void printHeader(){
+    std::cout << std::left << std::setw(28) << "case" << std::right
+              << std::setw(10) << "elements" << std::setw(10) << "dofs"
+              << std::setw(10) << "mesh[s]" << std::setw(10) << "init[s]" << std::setw(10) << "asm[s]"
+              << std::setw(10) << "solve[s]" << std::setw(10) << "norm[s]" << std::setw(10) << "out[s]"
+              << std::setw(12) << "us/elem" << std::setw(12) << "us/dof" << std::setw(14) << "H1" << std::endl;
+}
+
+void printRow(BenchmarkCase& c){
+    std::cout << std::left << std::setw(28) << c.name << std::right
+              << std::setw(10) << c.elements << std::setw(10) << c.dofs << std::fixed << std::setprecision(3)
+              << std::setw(10) << c.meshTime << std::setw(10) << c.initTime << std::setw(10) << c.assembleTime
+              << std::setw(10) << c.solveTime << std::setw(10) << c.normTime << std::setw(10) << c.outputTime
+              << std::setprecision(2) << std::setw(12) << 1e6*c.totalTime/c.elements
+              << std::setw(12) << 1e6*c.totalTime/c.dofs
+              << std::scientific << std::setprecision(3) << std::setw(14) << c.H1 << std::endl;
+    std::cout.unsetf(std::ios::floatfield);
+}
+
+void writeJSON(std::vector<BenchmarkCase>& cases, std::string label, std::string fileName){
+    std::ofstream out(utilities::getPath() + fileName);
+    if(!out.good()){
+        throw std::runtime_error("Could not open file. Please check path.");
+    }
+
+    out << std::setprecision(9);
+    out << "{\n  \"label\": \"" << label << "\",\n  \"compiler\": \"" << __VERSION__ << "\",\n"
+        << "  \"instrumentation\": "
+#ifdef VEAMY_INSTRUMENTATION
+        << "true"
+#else
+        << "false"
+#endif
+        << ",\n  \"cases\": [\n";
+
+    for (int i = 0; i < cases.size(); ++i) {
+        BenchmarkCase& c = cases[i];
+        out << "    {\"name\": \"" << c.name << "\", \"method\": \"" << c.method << "\", \"elements\": " << c.elements
+            << ", \"points\": " << c.points << ", \"dofs\": " << c.dofs
+            << ", \"mesh\": " << c.meshTime << ", \"init\": " << c.initTime << ", \"assemble\": " << c.assembleTime
+            << ", \"solve\": " << c.solveTime << ", \"norms\": " << c.normTime
+            << ", \"output\": " << c.outputTime << ", \"total\": " << c.totalTime
+            << ", \"seconds_per_element\": " << c.totalTime/c.elements
+            << ", \"seconds_per_dof\": " << c.totalTime/c.dofs
+            << ", \"L2\": " << c.L2 << ", \"H1\": " << c.H1;
+
+        if(!c.phases.empty()){
+            out << ", \"profile\": " << c.phases;
+        }
+        out << "}" << (i+1<cases.size()? "," : "") << "\n";
+    }
+
+    out << "  ]\n}\n";
+}
+
+int main(int argc, char** argv){
+    // Usage: Benchmark [maximum number of elements] [results file] [label]
+    // The global stiffness matrix is assembled as a dense matrix, so memory grows with the square of the number of
+    // DOFs: cases above ~5000 elements need several GB. The results file is written relative to the user path.
+    int maxElements = argc > 1? std::atoi(argv[1]) : 3000;
+    std::string resultsFile = argc > 2? argv[2] : "benchmark_results.json";
+    std::string label = argc > 3? argv[3] : "default";
+
+    int sizes[] = {100, 300, 1000, 3000, 10000, 30000, 100000, 300000, 1000000};
+    std::vector<std::function<BenchmarkCase()>> cases;
+
+    for(int n: sizes){
+        if(n>maxElements){
+            break;
+        }
+
+        std::string suffix = "_" + utilities::toString(n);
+        cases.push_back([=](){ return runVeamyGenerated("square_vem" + suffix, unitSquare(), n); });
+        cases.push_back([=](){ return runVeamyGenerated("unicorn_vem" + suffix, unicorn(), n); });
+        cases.push_back([=](){ return runFeamyGenerated("square_fem" + suffix, unitSquare(), n); });
+        cases.push_back([=](){ return runFeamyGenerated("unicorn_fem" + suffix, unicorn(), n); });
+    }
+
+    std::string simpleFile = relativeToUserPath(VEAMY_TEST_FILES "polymesher2veamy_simple.txt");
+    std::string meshFile = relativeToUserPath(VEAMY_TEST_FILES "polymesher2veamy.txt");
+    cases.push_back([=](){ return runPolyMesherImport("polymesher_simple", simpleFile); });
+    cases.push_back([=](){ return runPolyMesherImport("polymesher", meshFile); });
+
+    std::cout << "*** Starting Veamy benchmark ***" << std::endl;
+    printHeader();
+
+    std::vector<BenchmarkCase> results;
+    for(std::function<BenchmarkCase()>& run: cases){
+        Profiler::instance()->reset();
+        clock_type::time_point start = clock_type::now();
+
+        BenchmarkCase c;
+        try{
+            c = run();
+        }catch(std::exception& e){
+            std::cout << "  case failed: " << e.what() << std::endl;
+            continue;
+        }
+        c.totalTime = secondsSince(start);
+
+#ifdef VEAMY_INSTRUMENTATION
+        std::ostringstream phases;
+        Profiler::instance()->printJSON(phases);
+        c.phases = phases.str();
+        c.phases.pop_back();
+#endif
+
+        printRow(c);
+        results.push_back(c);
+    }
+
+    writeJSON(results, label, resultsFile);
+    std::cout << "Results saved in " << utilities::getPath() + resultsFile << std::endl;
+    std::cout << "*** Veamy benchmark has ended ***" << std::endl;
+}
@@ -0,0 +1,720 @@
+//**************************************************************
+// Consistency checks of the mesh algorithms: each one is
+// compared with a brute force version (or with itself, to check
+// that it is deterministic) and the errors are counted
+//**************************************************************
+
+#include <delynoi/models/basic/Point.h>
+#include <delynoi/models/Region.h>
+#include <delynoi/models/generator/functions/functions.h>
+#include <delynoi/voronoi/IncrementalVoronoiGenerator.h>
+#include <delynoi/voronoi/TriangleVoronoiGenerator.h>
+#include <delynoi/voronoi/TriangleDelaunayGenerator.h>
+#include <delynoi/voronoi/LloydRelaxation.h>
+#include <delynoi/config/DelynoiConfig.h>
+#include <delynoi/models/MeshPartitioner.h>
+#include <delynoi/models/generator/size/DistanceSizeFunction.h>
+#include <delynoi/models/hole/CircularHole.h>
+#include <delynoi/utilities/parallel.h>
+#include <veamy/postprocess/writers/StreamingResultWriter.h>
+#include <utilities/utilities.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+double distance(const Point& a, const Point& b){
+    return std::sqrt(std::pow(a.getX() - b.getX(), 2) + std::pow(a.getY() - b.getY(), 2));
+}
+
+double signedArea(const std::vector<Point>& points){
+    double area = 0;
+    int n = (int) points.size();
+    for (int i = 0; i < n; ++i) {
+        const Point& a = points[i];
+        const Point& b = points[(i + 1)%n];
+        area += a.getX()*b.getY() - b.getX()*a.getY();
+    }
+
+    return area/2;
+}
+
+// Every cell must be counterclockwise, the cells must cover the domain, and each vertex of a cell must be at least as
+// close to the seed of the cell as to any other seed
+int checkDiagram(IncrementalVoronoiGenerator& generator, double domainArea){
+    std::vector<int> ids = generator.getCellIds();
+    std::vector<Point> seeds;
+    for(int id: ids){
+        seeds.push_back(generator.getSeed(id));
+    }
+
+    int errors = 0;
+    double area = 0;
+    for (int i = 0; i < (int) ids.size(); ++i) {
+        std::vector<Point> cell = generator.getCellPoints(ids[i]);
+        double cellArea = signedArea(cell);
+        if(cellArea<=0){
+            errors++;
+        }
+        area += cellArea;
+
+        for(Point& vertex: cell){
+            double own = distance(vertex, seeds[i]);
+            for(Point& seed: seeds){
+                if(distance(vertex, seed) < own - 1e-8){
+                    errors++;
+                    break;
+                }
+            }
+        }
+    }
+
+    if(std::abs(area - domainArea) > 1e-8*domainArea){
+        errors++;
+    }
+
+    return errors;
+}
+
+// An update that fails must leave the diagram as it was
+int checkRejectedMove(IncrementalVoronoiGenerator& generator, std::vector<int> ids, std::vector<Point> positions){
+    std::vector<int> cellIds = generator.getCellIds();
+    std::vector<std::vector<Point>> cells;
+    for(int id: cellIds){
+        cells.push_back(generator.getCellPoints(id));
+    }
+
+    try{
+        generator.move(ids, positions);
+        return 1;
+    }catch(std::invalid_argument&){ }
+
+    if(generator.getCellIds()!=cellIds){
+        return 1;
+    }
+    for (int i = 0; i < (int) cellIds.size(); ++i) {
+        if(generator.getCellPoints(cellIds[i])!=cells[i]){
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int incrementalVoronoiChecks(){
+    std::vector<Point> square = {Point(0,0), Point(10,0), Point(10,10), Point(0,10)};
+    Region region(square);
+    region.generateSeedPoints(PointGenerator(functions::constant(), functions::constant()), 10, 10);
+    std::vector<Point> seeds = region.getSeedPoints();
+    std::vector<Point> regionPoints = region.getRegionPoints();
+    double area = region.getArea(regionPoints);
+
+    IncrementalVoronoiGenerator generator(seeds, region);
+    int errors = checkDiagram(generator, area);
+
+    std::mt19937 random(3);
+    std::uniform_real_distribution<double> coordinate(0, 10), displacement(-0.2, 0.2);
+    for (int step = 1; step <= 300; ++step) {
+        std::vector<int> ids = generator.getCellIds();
+
+        if(step%3==0){
+            int id = ids[random()%ids.size()];
+            if(!generator.getSeed(id).isInBoundary()){
+                generator.remove(id);
+            }
+        }else if(step%3==1){
+            generator.insert(Point(coordinate(random), step%7==0? 0.0 : coordinate(random)));
+        }else{
+            std::vector<int> moved;
+            std::vector<Point> positions;
+            for (int k = 0; k < 5; ++k) {
+                int id = ids[random()%ids.size()];
+                Point seed = generator.getSeed(id);
+                Point position(seed.getX() + displacement(random), seed.getY() + displacement(random));
+
+                if(!seed.isInBoundary() && generator.contains(position) &&
+                   std::find(moved.begin(), moved.end(), id)==moved.end()){
+                    moved.push_back(id);
+                    positions.push_back(position);
+                }
+            }
+            generator.move(moved, positions);
+        }
+
+        if(step%50==0){
+            errors += checkDiagram(generator, area);
+        }
+    }
+
+    // Batches with an invalid entry after valid ones (a repeated id, an unknown id) and with a position outside the domain
+    std::vector<int> ids = generator.getCellIds();
+    int interior = -1;
+    for(int id: ids){
+        if(!generator.getSeed(id).isInBoundary()){
+            interior = id;
+            break;
+        }
+    }
+    Point seed = generator.getSeed(interior);
+    Point nearby(seed.getX() + 0.01, seed.getY());
+
+    errors += checkRejectedMove(generator, {interior, interior}, {nearby, nearby});
+    errors += checkRejectedMove(generator, {interior, ids.back() + 1}, {nearby, nearby});
+    errors += checkRejectedMove(generator, {interior}, {Point(20, 20)});
+    errors += checkDiagram(generator, area);
+
+    return errors;
+}
+
+// The reordered mesh must be the original one renumbered through its permutations, and its neighbourhood maps must
+// agree with its elements
+template <typename T>
+int checkReordering(Mesh<T>& original, Mesh<T>& reordered){
+    std::vector<Point>& originalPoints = original.getPoints().getList();
+    std::vector<Point>& points = reordered.getPoints().getList();
+    const std::vector<int>& pointPermutation = reordered.getPointPermutation();
+    const std::vector<int>& polygonPermutation = reordered.getPolygonPermutation();
+
+    if(points.size()!=originalPoints.size() || pointPermutation.size()!=points.size() ||
+       polygonPermutation.size()!=reordered.getPolygons().size() ||
+       reordered.getPolygons().size()!=original.getPolygons().size()){
+        return 1;
+    }
+
+    int errors = 0;
+    for (int i = 0; i < (int) points.size(); ++i) {
+        if(!(points[i]==originalPoints[pointPermutation[i]])){
+            errors++;
+        }
+    }
+
+    for (int i = 0; i < (int) polygonPermutation.size(); ++i) {
+        std::vector<int> polygonPoints = reordered.getPolygon(i).getPoints();
+        for(int& point: polygonPoints){
+            point = pointPermutation[point];
+        }
+
+        if(polygonPoints!=original.getPolygon(polygonPermutation[i]).getPoints()){
+            errors++;
+        }
+    }
+
+    if(reordered.getSegments()->getMap().size()!=original.getSegments()->getMap().size()){
+        errors++;
+    }
+    for(auto& entry: reordered.getSegments()->getMap()){
+        IndexSegment segment = entry.first;
+        if(!reordered.getPolygon(entry.second.getFirst()).containsEdge(segment)){
+            errors++;
+        }
+        if(entry.second.getSecond()>=0 && !reordered.getPolygon(entry.second.getSecond()).containsEdge(segment)){
+            errors++;
+        }
+    }
+
+    for(auto& entry: reordered.getPointMap()->getMap()){
+        for(int neighbour: entry.second.getNeighbours()){
+            std::vector<int> polygonPoints = reordered.getPolygon(neighbour).getPoints();
+            bool found = false;
+            for(int point: polygonPoints){
+                found = found || points[point]==entry.first;
+            }
+
+            if(!found){
+                errors++;
+            }
+        }
+    }
+
+    return errors;
+}
+
+// With the original numbering, a reordered mesh must be written exactly as the mesh it came from
+template <typename T>
+int checkOriginalNumbering(Mesh<T>& original, Mesh<T>& reordered){
+    DelynoiConfig::instance()->setOriginalNumbering(true);
+    original.printInFile("consistency_original.txt");
+    reordered.printInFile("consistency_reordered.txt");
+    DelynoiConfig::instance()->setOriginalNumbering(false);
+
+    std::string path = utilities::getPath();
+    std::ifstream originalFile(path + "consistency_original.txt"), reorderedFile(path + "consistency_reordered.txt");
+    std::stringstream originalContents, reorderedContents;
+    originalContents << originalFile.rdbuf();
+    reorderedContents << reorderedFile.rdbuf();
+    originalFile.close();
+    reorderedFile.close();
+
+    std::remove((path + "consistency_original.txt").c_str());
+    std::remove((path + "consistency_reordered.txt").c_str());
+
+    return originalContents.str()==reorderedContents.str()? 0 : 1;
+}
+
+int reorderingChecks(){
+    std::vector<Point> rectangle = {Point(0,-2), Point(8,-2), Point(8,2), Point(0,2)};
+    Region region(rectangle);
+    region.generateSeedPoints(PointGenerator(functions::random_double(0,8), functions::random_double(-2,2)), 20, 10);
+    std::vector<Point> seeds = region.getSeedPoints();
+
+    DelynoiConfig* config = DelynoiConfig::instance();
+    config->setMeshOrdering(MeshOrdering::Original);
+    Mesh<Polygon> voronoi = TriangleVoronoiGenerator(seeds, region).getMesh();
+    Mesh<Triangle> delaunay = TriangleDelaunayGenerator(seeds, region).getConformingDelaunayTriangulation();
+
+    int errors = 0;
+    MeshOrdering orderings[] = {MeshOrdering::Hilbert, MeshOrdering::Morton};
+    for(MeshOrdering ordering: orderings){
+        config->setMeshOrdering(ordering);
+
+        Mesh<Polygon> reorderedVoronoi = TriangleVoronoiGenerator(seeds, region).getMesh();
+        Mesh<Triangle> reorderedDelaunay = TriangleDelaunayGenerator(seeds, region).getConformingDelaunayTriangulation();
+        errors += checkReordering(voronoi, reorderedVoronoi);
+        errors += checkReordering(delaunay, reorderedDelaunay);
+        errors += checkOriginalNumbering(voronoi, reorderedVoronoi);
+        errors += checkOriginalNumbering(delaunay, reorderedDelaunay);
+    }
+    config->setMeshOrdering(MeshOrdering::Original);
+
+    return errors;
+}
+
+// The edge cut and the interface nodes of each part must be the ones found by brute force, the parts must respect the
+// imbalance tolerance, and partitioning again must give the same result
+int checkPartition(const MeshTopology& topology, int numberOfParts, double imbalance){
+    MeshPartitioner partitioner(imbalance);
+    MeshPartition partition = partitioner.partition(topology, numberOfParts);
+    MeshPartition again = partitioner.partition(topology, numberOfParts);
+
+    int errors = 0;
+    if(partition.parts!=again.parts || partition.interfaceNodes!=again.interfaceNodes){
+        errors++;
+    }
+
+    int cut = 0;
+    for (int e = 0; e < topology.getNumberOfEdges(); ++e) {
+        std::pair<int,int> cells = topology.edgeCells(e);
+        if(cells.second>=0 && partition.parts[cells.first]!=partition.parts[cells.second]){
+            cut++;
+        }
+    }
+    if(cut!=partition.edgeCut){
+        errors++;
+    }
+
+    for (int v = 0; v < topology.getNumberOfVertices(); ++v) {
+        std::vector<int> parts;
+        for(int c: topology.vertexStar(v)){
+            parts.push_back(partition.parts[c]);
+        }
+        std::sort(parts.begin(), parts.end());
+        parts.erase(std::unique(parts.begin(), parts.end()), parts.end());
+
+        for (int p = 0; p < numberOfParts; ++p) {
+            bool listed = std::binary_search(partition.interfaceNodes.begin() + partition.interfaceOffsets[p],
+                                             partition.interfaceNodes.begin() + partition.interfaceOffsets[p + 1], v);
+            bool shared = parts.size()>1 && std::binary_search(parts.begin(), parts.end(), p);
+
+            if(listed!=shared){
+                errors++;
+            }
+        }
+    }
+
+    std::vector<int> weights(numberOfParts, 0);
+    for(int p: partition.parts){
+        weights[p]++;
+    }
+    double average = topology.getNumberOfCells()/(double) numberOfParts;
+    if(*std::max_element(weights.begin(), weights.end()) > std::ceil((1 + imbalance)*average)){
+        errors++;
+    }
+
+    return errors;
+}
+
+int partitionerChecks(){
+    // Structured quadrilaterals
+    int n = 60;
+    std::vector<int> offsets(1, 0), vertices;
+    for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+            int a = j*(n + 1) + i;
+            vertices.insert(vertices.end(), {a, a + 1, a + n + 2, a + n + 1});
+            offsets.push_back((int) vertices.size());
+        }
+    }
+    MeshTopology quadrilaterals((n + 1)*(n + 1), offsets, vertices);
+
+    // Voronoi mesh with random seeds
+    std::vector<Point> square = {Point(0,0), Point(10,0), Point(10,10), Point(0,10)};
+    Region region(square);
+    region.generateSeedPoints(PointGenerator(functions::random_double(0,10), functions::random_double(0,10)), 40, 40);
+    std::vector<Point> seeds = region.getSeedPoints();
+    Mesh<Polygon> voronoi = TriangleVoronoiGenerator(seeds, region).getMesh();
+
+    int errors = 0;
+    int parts[] = {2, 7, 16};
+    for(int k: parts){
+        errors += checkPartition(quadrilaterals, k, 0.03);
+        errors += checkPartition(voronoi.getTopology(), k, 0.03);
+    }
+
+    return errors;
+}
+
+// The graded size must be the one given by the distance to the nearest feature, found by scanning all of them
+int sizeFunctionChecks(){
+    std::mt19937 random(3);
+    std::uniform_real_distribution<double> coordinate(0, 10), offset(-1.5, 1.5), query(-3, 13);
+
+    int errors = 0;
+    int features[] = {1, 50, 2000};
+    double gradients[] = {0.0, 0.3, 5.0};
+    for(int numberOfFeatures: features){
+        for(double gradient: gradients){
+            DistanceSizeFunction function(0.05, 1.0, gradient);
+            std::vector<PointSegment> segments;
+            for (int k = 0; k < numberOfFeatures; ++k) {
+                Point a(coordinate(random), coordinate(random));
+                Point b = k%5==0? a : Point(a.getX() + offset(random), a.getY() + offset(random));
+
+                if(k%5==0){
+                    function.addPoint(a);
+                }else{
+                    function.addSegment(PointSegment(a, b));
+                }
+                segments.push_back(PointSegment(a, b));
+            }
+
+            for (int i = 0; i < 2000; ++i) {
+                Point p(query(random), query(random));
+                double nearest = std::numeric_limits<double>::infinity();
+                for(PointSegment& segment: segments){
+                    Point a = segment.getFirst(), b = segment.getSecond();
+                    double dX = b.getX() - a.getX(), dY = b.getY() - a.getY();
+                    double length = dX*dX + dY*dY;
+                    double t = length>0? ((p.getX() - a.getX())*dX + (p.getY() - a.getY())*dY)/length : 0;
+                    t = std::max(0.0, std::min(1.0, t));
+
+                    nearest = std::min(nearest, distance(p, Point(a.getX() + t*dX, a.getY() + t*dY)));
+                }
+
+                if(std::abs(function.apply(p) - std::min(1.0, 0.05 + gradient*nearest)) > 1e-12){
+                    errors++;
+                }
+            }
+        }
+    }
+
+    return errors;
+}
+
+// The seeds kept by the region (classified with its cached grid) must be the ones inside the outline and outside every
+// hole by the exact tests, including seeds on the outline and on the holes
+int regionClassifierChecks(){
+    std::vector<Point> outline;
+    int n = 500;
+    for (int i = 0; i < n; ++i) {
+        double angle = 2*M_PI*i/n;
+        double radius = 10 + 2*std::sin(7*angle);
+        outline.push_back(Point(radius*std::cos(angle), radius*std::sin(angle)));
+    }
+
+    Region region(outline);
+    for (int i = -3; i <= 3; ++i) {
+        for (int j = -3; j <= 3; ++j) {
+            if(i*i + j*j<=9){
+                CircularHole hole(Point(2*i, 2*j), 0.6);
+                region.addHole(hole);
+            }
+        }
+    }
+
+    std::vector<Hole> holes = region.getHoles();
+    std::mt19937 random(5);
+    std::uniform_real_distribution<double> coordinate(-13, 13);
+    std::vector<Point> seeds;
+    for (int i = 0; i < 20000; ++i) {
+        seeds.push_back(Point(coordinate(random), coordinate(random)));
+    }
+    for (int i = 0; i < n; i += 7) {
+        seeds.push_back(outline[i]);
+    }
+    for(Hole& hole: holes){
+        seeds.push_back(hole.getPoints()[0]);
+    }
+
+    std::vector<Point> expected;
+    for(Point& seed: seeds){
+        bool inside = region.containsPoint(seed);
+        for(Hole& hole: holes){
+            inside = inside && !hole.containsPoint(seed);
+        }
+
+        if(inside){
+            expected.push_back(seed);
+        }
+    }
+
+    region.addSeedPoints(seeds);
+    std::vector<Point> kept = region.getSeedPoints();
+    if(kept.size()!=expected.size()){
+        return 1;
+    }
+
+    int errors = 0;
+    for (int i = 0; i < (int) kept.size(); ++i) {
+        if(kept[i].getX()!=expected[i].getX() || kept[i].getY()!=expected[i].getY()){
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+// The sweep line self-intersection test must agree with testing every pair of non adjacent sides, on random polygons
+// and on polygons with vertices on an integer grid (with collinear sides and repeated vertices)
+int selfIntersectionChecks(){
+    std::mt19937 random(3);
+    std::uniform_real_distribution<double> coordinate(0, 1);
+
+    int errors = 0;
+    for (int trial = 0; trial < 20000; ++trial) {
+        int n = 4 + random()%9;
+        std::vector<Point> points;
+        std::vector<int> indexes;
+        for (int i = 0; i < n; ++i) {
+            if(trial%2==0){
+                points.push_back(Point(coordinate(random), coordinate(random)));
+            }else{
+                points.push_back(Point((int) (coordinate(random)*5), (int) (coordinate(random)*5)));
+            }
+            indexes.push_back(i);
+        }
+
+        Polygon polygon(indexes, points, false);
+        std::vector<IndexSegment> sides;
+        polygon.getSegments(sides);
+
+        bool intersecting = false;
+        Point intersection;
+        for (int i = 0; i < n && !intersecting; ++i) {
+            for (int j = 0; j < n && !intersecting; ++j) {
+                if(j!=i && j!=(i + 1)%n && j!=(i + n - 1)%n){
+                    intersecting = sides[i].intersection(points, sides[j], intersection);
+                }
+            }
+        }
+
+        if(polygon.isSelfIntersecting(points)!=intersecting){
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+// Every point must be located in the first element that contains it (whatever the hint and the number of threads),
+// and its interpolation coordinates must reproduce it
+template <typename T>
+int checkLocation(Mesh<T>& mesh){
+    std::vector<Point>& points = mesh.getPoints().getList();
+    std::vector<T>& elements = mesh.getPolygons();
+    int m = (int) elements.size();
+
+    std::mt19937 random(3);
+    std::uniform_real_distribution<double> x(-0.5, 8.5), y(-2.5, 2.5);
+    std::vector<Point> queries;
+    for (int i = 0; i < 2000; ++i) {
+        queries.push_back(Point(x(random), y(random)));
+    }
+    for (int i = 0; i < 200; ++i) {
+        std::vector<int>& vertices = elements[i%m].getPoints();
+        Point a = points[vertices[0]], b = points[vertices[1]];
+        queries.push_back(a);
+        queries.push_back(Point((a.getX() + b.getX())/2, (a.getY() + b.getY())/2));
+    }
+
+    DelynoiConfig* config = DelynoiConfig::instance();
+    int threads = config->getNumberOfThreads();
+    PointLocations locations, threadedLocations;
+    config->setNumberOfThreads(1);
+    mesh.getLocator().locate(queries, locations);
+    config->setNumberOfThreads(3);
+    mesh.getLocator().locate(queries, threadedLocations);
+    config->setNumberOfThreads(threads);
+
+    int errors = 0;
+    if(locations.elements!=threadedLocations.elements || locations.coordinates!=threadedLocations.coordinates){
+        errors++;
+    }
+
+    for (int i = 0; i < (int) queries.size(); ++i) {
+        int expected = -1;
+        for (int e = 0; e < m && expected<0; ++e) {
+            if(elements[e].containsPoint(points, queries[i])){
+                expected = e;
+            }
+        }
+
+        int element = locations.elements[i];
+        if(element!=expected || mesh.getLocator().locate(queries[i], (7*i)%m)!=expected){
+            errors++;
+            continue;
+        }
+        if(element<0){
+            continue;
+        }
+
+        std::vector<int>& vertices = elements[element].getPoints();
+        double pX = 0, pY = 0, sum = 0;
+        for (int k = 0; k < (int) vertices.size(); ++k) {
+            double w = locations.coordinates[locations.offsets[i] + k];
+            pX += w*points[vertices[k]].getX();
+            pY += w*points[vertices[k]].getY();
+            sum += w;
+        }
+
+        if(std::abs(pX - queries[i].getX()) > 1e-9 || std::abs(pY - queries[i].getY()) > 1e-9 ||
+           std::abs(sum - 1) > 1e-12){
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+int pointLocatorChecks(){
+    std::vector<Point> rectangle = {Point(0,-2), Point(8,-2), Point(8,2), Point(0,2)};
+    Region region(rectangle);
+    region.generateSeedPoints(PointGenerator(functions::random_double(0,8), functions::random_double(-2,2)), 25, 20);
+    std::vector<Point> seeds = region.getSeedPoints();
+
+    Mesh<Polygon> voronoi = TriangleVoronoiGenerator(seeds, region).getMesh();
+    Mesh<Triangle> delaunay = TriangleDelaunayGenerator(seeds, region).getConformingDelaunayTriangulation();
+
+    return checkLocation(voronoi) + checkLocation(delaunay);
+}
+
+// An exception thrown in any block of a parallel loop must reach the calling thread once all the blocks finished
+int parallelForChecks(){
+    int errors = 0;
+    for (int failing = 0; failing < 4; ++failing) {
+        std::vector<char> done(4, false);
+        try{
+            delynoi_utilities::parallelFor(4, 4, [&](int begin, int end){
+                for (int i = begin; i < end; ++i) {
+                    done[i] = true;
+                    if(i==failing){
+                        throw std::runtime_error("Failing block");
+                    }
+                }
+            });
+            errors++;
+        }catch(std::runtime_error&){
+            if(std::count(done.begin(), done.end(), true)!=4){
+                errors++;
+            }
+        }
+    }
+
+    return errors;
+}
+
+// Writing to a closed result writer must fail instead of silently dropping the data, both for the writer and for the
+// one that writes in its own thread
+int resultWriterChecks(){
+    int errors = 0;
+    std::string path = utilities::getPath();
+
+    for (int streaming = 0; streaming < 2; ++streaming) {
+        std::string file = "consistency_results.txt";
+        ResultWriter* writer = streaming? new StreamingResultWriter(file, ResultFormat::Text, 1, 2, 6) :
+                               new ResultWriter(file, ResultFormat::Text, 1, 2, 6);
+
+        NodeBlock block;
+        block.first = 0;
+        block.values = {1.0};
+        block.defined = {true};
+        writer->write(block);
+        writer->close();
+
+        block.first = 1;
+        block.values = {2.0};
+        block.defined = {true};
+        try{
+            writer->write(block);
+            errors++;
+        }catch(std::invalid_argument&){}
+
+        delete writer;
+        std::remove((path + file).c_str());
+    }
+
+    return errors;
+}
+
+// Relaxes random seeds (one per unit of area) in a square
+double lloydTime(int seedsPerSide, int iterations, int& cells){
+    double side = seedsPerSide;
+    std::vector<Point> square = {Point(0,0), Point(side,0), Point(side,side), Point(0,side)};
+    Region region(square);
+    region.generateSeedPoints(PointGenerator(functions::random_double(0,side), functions::random_double(0,side)),
+                              seedsPerSide, seedsPerSide);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    LloydRelaxation relaxation(iterations, 0);
+    cells = (int) relaxation.relax(region).getPolygons().size();
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// The cost of a Lloyd iteration must grow linearly with the number of seeds: each seed is searched from its own
+// position, so the relaxation of four times more seeds must take about four times longer (a search across the domain
+// for each seed would make it sixteen times longer). The best of several runs is taken to reduce the noise
+int lloydScalingChecks(){
+    double small = std::numeric_limits<double>::infinity(), large = small;
+    int smallCells, largeCells;
+    for (int run = 0; run < 3; ++run) {
+        small = std::min(small, lloydTime(50, 3, smallCells));
+        large = std::min(large, lloydTime(100, 3, largeCells));
+    }
+
+    int errors = 0;
+    if(smallCells < 2500 || largeCells < 10000){
+        errors++;
+    }
+    if(large > 8*small){
+        errors++;
+    }
+
+    return errors;
+}
+
+int report(std::string name, int errors){
+    std::cout << name << ": " << errors << " errors" << std::endl;
+    return errors;
+}
+
+int main(){
+    int errors = report("Incremental Voronoi", incrementalVoronoiChecks());
+    errors += report("Mesh reordering", reorderingChecks());
+    errors += report("Mesh partitioner", partitionerChecks());
+    errors += report("Distance size function", sizeFunctionChecks());
+    errors += report("Region classifier", regionClassifierChecks());
+    errors += report("Polygon self-intersection", selfIntersectionChecks());
+    errors += report("Point location", pointLocatorChecks());
+    errors += report("Parallel loops", parallelForChecks());
+    errors += report("Result writers", resultWriterChecks());
+    errors += report("Lloyd relaxation scaling", lloydScalingChecks());
+
+    return errors==0? 0 : 1;
+}
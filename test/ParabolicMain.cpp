@@ -7,6 +7,7 @@
 #include <veamy/models/constraints/values/Function.h>
 #include <chrono>
 #include <utilities/utilities.h>
+#include <utilities/Profiler.h>
 #include <veamy/physics/materials/MaterialPlaneStrain.h>
 #include <veamy/postprocess/L2NormCalculator.h>
 #include <veamy/postprocess/H1NormCalculator.h>
@@ -133,5 +134,8 @@ int main(){
     path2 +=  dispFileName;
     std::cout << path1 << std::endl;
     std::cout << path2 << std::endl;
+#ifdef VEAMY_INSTRUMENTATION
+    Profiler::instance()->printTable(std::cout);
+#endif
     std::cout << "*** Veamy has ended ***" << std::endl;
 }
@@ -2,7 +2,8 @@
 #define VEAMY_FEAMYCONFIG_H
 
 /*
- * Class that encapsulates all configuration parameters of the Feamy module
+ * Class that encapsulates all configuration parameters of the Feamy module. As DelynoiConfig, each thread uses the
+ * default instance unless another one is activated for it
  */
 class FeamyConfig {
 private:
@@ -12,15 +13,30 @@ private:
     int gaussPoints;
 
     /*
-     * Unique instance of FeamyConfig (following the Singleton pattern)
+     * Configuration activated for the calling thread (null when the thread uses the default one)
      */
-    static FeamyConfig* s_instance;
+    static thread_local FeamyConfig* active;
 
     /*
      * Constructor
      */
     FeamyConfig();
+
+    /*
+     * @return the process wide default instance
+     */
+    static FeamyConfig* defaultInstance();
 public:
+    /*
+     * Copy constructor, used to create independent configurations that can be activated per thread
+     */
+    FeamyConfig(const FeamyConfig& other) = default;
+
+    /*
+     * Assignment operator
+     */
+    FeamyConfig& operator=(const FeamyConfig& other) = default;
+
     /* Sets a new value for the number of gauss points
      * @param gauss value to set
      */
@@ -32,9 +48,17 @@ public:
     int getNumberOfGaussPoints();
 
     /*
-     * @return instance of FeamyConfig
+     * @return instance of FeamyConfig used by the calling thread
+     */
+    static FeamyConfig* instance(){
+        return active!=nullptr? active : defaultInstance();
+    }
+
+    /* Activates a configuration for the calling thread. The instance must outlive its activation
+     * @param config configuration to activate (null to go back to the default one)
+     * @return the previously activated configuration (null if it was the default one)
      */
-    static  FeamyConfig* instance();
+    static FeamyConfig* activate(FeamyConfig* config);
 };
 
 #endif
\ No newline at end of file
@@ -9,6 +9,36 @@
  * Namespace which contain functions related to the gaussian quadratures
  */
 namespace gauss_quadrature{
+    /*
+     * Quadrature rule of a line, in the reference segment [-1,1]
+     */
+    struct LineRule {
+        int size;
+        const double* points;
+        const double* weights;
+    };
+
+    /*
+     * Quadrature rule of a triangle: barycentric coordinates of the points and weights as fractions of the area
+     */
+    struct TriangleRule {
+        int size;
+        const double (*points)[3];
+        const double* weights;
+    };
+
+    /* Gets the reference quadrature rule of a line (stored in static tables, so nothing is allocated)
+     * @param order order of the quadrature (from 1 to 10)
+     * @return the rule of the given order, or an empty rule if there is no rule of that order
+     */
+    extern LineRule line_rule(int order);
+
+    /* Gets the reference quadrature rule of a triangle (stored in static tables, so nothing is allocated)
+     * @param order order of the quadrature (from 1 to 5)
+     * @return the rule of the given order, or an empty rule if there is no rule of that order
+     */
+    extern TriangleRule triangle_rule(int order);
+
     /*
      * Sets in two given vectors the quadrature points and weights of a line
      * @param order order of the quadrature
@@ -16,6 +46,23 @@ namespace gauss_quadrature{
      */
     extern void gauss_1d(int order, std::vector<double>& points, std::vector<double>& weights);
 
+    /* Maps a triangle rule to a physical triangle
+     * @param rule reference rule
+     * @param triangle points of the triangle (one per row)
+     * @param area area of the triangle
+     * @param x,y,w arrays (with rule.size elements) where the coordinates and weights of the points will be set
+     */
+    inline void map_triangle_rule(const TriangleRule& rule, const Eigen::MatrixXd& triangle, double area,
+                                  double* x, double* y, double* w){
+        for (int i = 0; i < rule.size; ++i) {
+            const double* l = rule.points[i];
+
+            x[i] = l[0]*triangle(0,0) + l[1]*triangle(1,0) + l[2]*triangle(2,0);
+            y[i] = l[0]*triangle(0,1) + l[1]*triangle(1,1) + l[2]*triangle(2,1);
+            w[i] = rule.weights[i]*area;
+        }
+    }
+
     /* Creates a matrix with the points of a polygon
      * @param t polygon
      * @param points mesh points
@@ -51,92 +98,17 @@ namespace gauss_quadrature{
         Eigen::MatrixXd triangle = gauss_quadrature::trianglePoints(poly, meshPoints);
         double area = poly.getArea(meshPoints);
 
-        if (order == 1) {
-            Eigen::Matrix<double, 1, 3> t;
-            t << 1.0 / 3.0, 1.0 / 3.0, 1.0 / 3.0;
-
-            weights.push_back(1.0 * area);
-            points = t * triangle;
-
-            return;
-        }
-
-        if (order == 2) {
-            Eigen::Matrix<double, 3, 3> t;
-            t << 2.0 / 3.0, 1.0 / 6.0, 1.0 / 6.0,
-                    1.0 / 6.0, 2.0 / 3.0, 1.0 / 6.0,
-                    1.0 / 6.0, 1.0 / 6.0, 2.0 / 3.0;
-
-            weights.push_back(1.0 / 3.0 * area);
-            weights.push_back(1.0 / 3.0 * area);
-            weights.push_back(1.0 / 3.0 * area);
+        TriangleRule rule = triangle_rule(order);
+        std::vector<double> x(rule.size), y(rule.size);
+        std::size_t first = weights.size();
 
-            points = t * triangle;
-
-            return;
-        }
-
-        if (order == 3) {
-            Eigen::Matrix<double, 6, 3> t;
-            t << 0.659027622374092, 0.231933368553031, 0.109039009072877,
-                    0.109039009072877, 0.659027622374092, 0.231933368553031,
-                    0.231933368553031, 0.109039009072877, 0.659027622374092,
-                    0.109039009072877, 0.231933368553031, 0.659027622374092,
-                    0.231933368553031, 0.659027622374092, 0.109039009072877,
-                    0.659027622374092, 0.109039009072877, 0.231933368553031;
-
-            weights.push_back(1.0 / 6.0 * area);
-            weights.push_back(1.0 / 6.0 * area);
-            weights.push_back(1.0 / 6.0 * area);
-            weights.push_back(1.0 / 6.0 * area);
-            weights.push_back(1.0 / 6.0 * area);
-            weights.push_back(1.0 / 6.0 * area);
-
-            points = t * triangle;
-
-            return;
-        }
-
-        if (order == 4) {
-            Eigen::Matrix<double, 6, 3> t;
-            t << 0.816847572980459, 0.091576213509771, 0.091576213509771,
-                    0.091576213509771, 0.816847572980459, 0.091576213509771,
-                    0.091576213509771, 0.091576213509771, 0.816847572980459,
-                    0.108103018168070, 0.445948490915965, 0.445948490915965,
-                    0.445948490915965, 0.108103018168070, 0.445948490915965,
-                    0.445948490915965, 0.445948490915965, 0.108103018168070;
-
-            weights.push_back(0.109951743655322 * area);
-            weights.push_back(0.109951743655322 * area);
-            weights.push_back(0.109951743655322 * area);
-            weights.push_back(0.223381589678011 * area);
-            weights.push_back(0.223381589678011 * area);
-            weights.push_back(0.223381589678011 * area);
-
-            points = t * triangle;
-
-            return;
-        }
+        weights.resize(first + rule.size);
+        map_triangle_rule(rule, triangle, area, x.data(), y.data(), weights.data() + first);
 
-        if (order == 5) {
-            Eigen::Matrix<double, 7, 3> t;
-            t << 1.0 / 3.0, 1.0 / 3.0, 1.0 / 3.0,
-                    0.059715871789770, 0.470142064105115, 0.470142064105115,
-                    0.470142064105115, 0.059715871789770, 0.470142064105115,
-                    0.470142064105115, 0.470142064105115, 0.059715871789770,
-                    0.797426985353087, 0.101286507323456, 0.101286507323456,
-                    0.101286507323456, 0.797426985353087, 0.101286507323456,
-                    0.101286507323456, 0.101286507323456, 0.797426985353087;
-
-            weights.push_back(0.225000000000000 * area);
-            weights.push_back(0.132394152788506 * area);
-            weights.push_back(0.132394152788506 * area);
-            weights.push_back(0.132394152788506 * area);
-            weights.push_back(0.125939180544827 * area);
-            weights.push_back(0.125939180544827 * area);
-            weights.push_back(0.125939180544827 * area);
-
-            points = t * triangle;
+        points.resize(rule.size, 2);
+        for (int i = 0; i < rule.size; ++i) {
+            points(i,0) = x[i];
+            points(i,1) = y[i];
         }
     }
 }
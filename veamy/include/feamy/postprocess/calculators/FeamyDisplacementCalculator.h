@@ -35,6 +35,17 @@ public:
      */
     std::vector<double> getDisplacement(double x, double y, int index, T container);
 
+    /* Computes the approximate displacement for several points of the same element, looking up the degrees of
+     * freedom of the element only once
+     * @param x,y coordinates of the points
+     * @param n number of points
+     * @param container element that contains the points
+     * @param containerIndex index of the container element
+     * @param values vector where the displacements are set, point after point
+     */
+    void getDisplacements(const double* x, const double* y, int n, T& container, int containerIndex,
+                          std::vector<double>& values);
+
     /* Sets the polygon inside which the displacement will be calculated
      * @param polyIndex index of the polygon
      */
@@ -17,6 +17,13 @@ private:
      * List of elements of the system
      */
     std::vector<FeamyElement*> elements;
+
+    /*
+     * Inverse of the jacobian (four values per element, by rows) and nodal displacements of each element, set by
+     * prepare
+     */
+    std::vector<double> inverseJacobians;
+    std::vector<Eigen::VectorXd> nodalValues;
 public:
     /*
      * Constructor
@@ -30,6 +37,22 @@ public:
      * @return approximated strain
      */
     Eigen::VectorXd getStrain(double x, double y, T container, int containerIndex);
+
+    /* Computes the approximate strain for several points of the same element, computing the nodal values and
+     * the jacobian of the element only once
+     * @param x,y coordinates of the points
+     * @param n number of points
+     * @param container element that contains the points
+     * @param containerIndex index of the container element
+     * @param values vector where the strains are set, point after point
+     */
+    void getStrains(const double* x, const double* y, int n, T& container, int containerIndex,
+                    std::vector<double>& values);
+
+    /* Computes the inverse of the jacobian and the nodal displacements of every element, in parallel
+     * @param elements elements of the mesh
+     */
+    void prepare(std::vector<T>& elements);
 };
 
 #endif
\ No newline at end of file
@@ -7,6 +7,9 @@
 #include <veamy/problems/ProblemDiscretization.h>
 #include <veamy/models/Element.h>
 #include <veamy/lib/Eigen/Sparse>
+#include <veamy/postprocess/writers/ResultWriter.h>
+#include <veamy/postprocess/integrator/QuadratureCache.h>
+#include <memory>
 
 /*
  * Abstract class that encapsulates all common behaviour for linear elasticity calculations, no matter the method
@@ -30,6 +33,18 @@ protected:
      */
     UniqueList<Point> points;
 
+    /*
+     * Original index of each mesh point, if the mesh was reordered (empty otherwise), used to write the results with the
+     * original numbering when it is requested in DelynoiConfig
+     */
+    std::vector<int> pointPermutation;
+
+    /*
+     * Quadrature points of the last mesh whose norms were computed, shared by all the norms of that mesh. Discarded
+     * when a problem is initialized, as the mesh may have changed even if it is the same object
+     */
+    std::shared_ptr<QuadratureCache<T>> quadrature;
+
     /* Transforms a dense matrix to a sparse one
      * @param K dense matrix
      * @param coeffs vector where the indexes of the non zero values of K
@@ -72,11 +87,41 @@ public:
      */
     Eigen::VectorXd simulate(Mesh<T> &mesh);
 
+    /* Imposes the essential boundary conditions on an assembled system and solves it
+     * @param K global stiffness matrix, as returned by assemble (it is modified)
+     * @param f global load vector, as returned by assemble (it is modified)
+     * @return computed displacements
+     */
+    Eigen::VectorXd solve(Eigen::MatrixXd& K, Eigen::VectorXd& f);
+
     /* Writes the computed nodal displacements to a text file
      * @param fileName name of the file to write the displacements to
      * @param u computed displacements
      */
     void writeDisplacements(std::string fileName, Eigen::VectorXd &u);
+
+    /* Writes the computed nodal displacements to a file in the given format
+     * @param fileName name of the file to write the displacements to
+     * @param u computed displacements
+     * @param format format of the file (text or raw binary)
+     */
+    void writeDisplacements(std::string fileName, Eigen::VectorXd &u, ResultFormat format);
+
+    /* Sends the computed nodal displacements, in blocks of points, to a result writer. The writer is not closed, so
+     * that a StreamingResultWriter can keep writing while later phases continue. Points are sent in the order of the
+     * mesh, or in their original order if the mesh was reordered and DelynoiConfig asks for the original numbering
+     * @param writer result writer that receives the displacements
+     * @param u computed displacements
+     */
+    void writeDisplacements(ResultWriter& writer, Eigen::VectorXd &u);
+
+    /* Gets the quadrature points of a mesh, with the number of gauss points set in FeamyConfig, computing them only
+     * if they were not computed before for the same mesh and parameters
+     * @param mesh mesh to integrate
+     * @param triangulation way in which the elements are split in triangles
+     * @return quadrature points of the mesh
+     */
+    std::shared_ptr<QuadratureCache<T>> getQuadrature(Mesh<T>& mesh, ElementTriangulation triangulation);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,52 @@
+#ifndef VEAMY_BATCHRESULT_H
+#define VEAMY_BATCHRESULT_H
+
+#include <utilities/Profiler.h>
+#include <string>
+#include <vector>
+
+/*
+ * Summary of the solution of one problem of a batch: size, time spent in each phase (in seconds) and error norms
+ */
+struct BatchResult {
+    /*
+     * Name of the problem
+     */
+    std::string name;
+
+    /*
+     * Whether the problem was solved, and the error message if it was not
+     */
+    bool success = false;
+    std::string error;
+
+    /*
+     * Size of the discrete problem
+     */
+    int elements = 0;
+    int points = 0;
+    int dofs = 0;
+
+    /*
+     * Time spent creating the mesh, initializing the elements, solving the system and computing the norms
+     */
+    double meshTime = 0;
+    double setupTime = 0;
+    double solveTime = 0;
+    double normTime = 0;
+    double totalTime = 0;
+
+    /*
+     * Relative L2 norm and H1 seminorm of the error (negative if not computed), and element size reported with them
+     */
+    double L2 = -1;
+    double H1 = -1;
+    double h = -1;
+
+    /*
+     * Detailed records of each phase (only filled when the library is built with VEAMY_INSTRUMENTATION)
+     */
+    std::vector<PhaseRecord> phases;
+};
+
+#endif
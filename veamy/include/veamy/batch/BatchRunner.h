@@ -0,0 +1,87 @@
+#ifndef VEAMY_BATCHRUNNER_H
+#define VEAMY_BATCHRUNNER_H
+
+#include <veamy/batch/ProblemSpecification.h>
+#include <veamy/batch/BatchResult.h>
+#include <condition_variable>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+/*
+ * Class that solves a list of independent problems (for example, the meshes of a convergence study) concurrently,
+ * using a fixed number of worker threads. Each problem runs under its own ExecutionContext. To bound the memory
+ * usage, each problem reserves an estimate of its peak memory (dominated by the assembly of the global stiffness
+ * matrix) from a common budget before assembling, waiting until enough memory is released by the others
+ */
+class BatchRunner {
+private:
+    /*
+     * Number of worker threads
+     */
+    int threads;
+
+    /*
+     * Memory budget (in bytes) shared by all problems being solved, and amount currently reserved
+     */
+    size_t memoryBudget;
+    size_t memoryInUse;
+    std::mutex memoryMutex;
+    std::condition_variable memoryReleased;
+
+    /*
+     * Serializes the calls to the Triangle library, which keeps global state
+     */
+    std::mutex meshMutex;
+
+    /* Reserves memory from the budget, blocking until it is available. Requests larger than the whole budget wait
+     * until no other problem holds memory
+     * @param bytes memory to reserve
+     * @return memory actually reserved (to be released later)
+     */
+    size_t reserveMemory(size_t bytes);
+
+    /* Returns memory to the budget
+     * @param bytes memory to release
+     */
+    void releaseMemory(size_t bytes);
+
+    /* Solves a problem using VEM
+     * @param spec specification of the problem
+     * @param result structure where the results are stored
+     */
+    void solveVEM(ProblemSpecification& spec, BatchResult& result);
+
+    /* Solves a problem using FEM (linear triangles)
+     * @param spec specification of the problem
+     * @param result structure where the results are stored
+     */
+    void solveFEM(ProblemSpecification& spec, BatchResult& result);
+
+    /* Solves one problem, catching any error so the rest of the batch can continue
+     * @param spec specification of the problem
+     * @return summary of the solution
+     */
+    BatchResult solve(ProblemSpecification& spec);
+public:
+    /*
+     * Constructor
+     * @param threads number of worker threads (zero to use one per hardware thread)
+     * @param memoryBudget maximum memory (in bytes) reserved at the same time by all problems (zero for no limit)
+     */
+    BatchRunner(int threads = 0, size_t memoryBudget = 0);
+
+    /* Solves all problems
+     * @param problems specification of the problems to solve
+     * @return summary of each problem, in the same order of the specifications
+     */
+    std::vector<BatchResult> run(std::vector<ProblemSpecification>& problems);
+
+    /* Prints the consolidated table of timings and error norms
+     * @param results results of a batch
+     * @param out stream where the table is printed
+     */
+    static void printTable(std::vector<BatchResult>& results, std::ostream& out);
+};
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef VEAMY_PROBLEMSPECIFICATION_H
+#define VEAMY_PROBLEMSPECIFICATION_H
+
+#include <delynoi/models/Region.h>
+#include <delynoi/models/generator/PointGenerator.h>
+#include <veamy/config/ExecutionContext.h>
+#include <veamy/physics/materials/Material.h>
+#include <veamy/physics/conditions/LinearElasticityConditions.h>
+#include <veamy/postprocess/analytic/DisplacementValue.h>
+#include <veamy/postprocess/analytic/StrainValue.h>
+#include <functional>
+#include <string>
+
+/*
+ * Numerical method used to solve a problem of a batch
+ */
+enum class BatchMethod {VEM, FEM};
+
+/*
+ * Description of one independent linear elasticity problem to be solved by the BatchRunner. The mesh is either read
+ * from a file (meshFile) or generated from a region and a seed point generator. Pointers (region, material, exact
+ * solutions) are not owned and are only read, so they can be shared between specifications
+ */
+struct ProblemSpecification {
+    /*
+     * Name used to identify the problem in the results table
+     */
+    std::string name;
+
+    /*
+     * Method used to solve the problem (VEM uses Voronoi meshes, FEM three node triangles)
+     */
+    BatchMethod method = BatchMethod::VEM;
+
+    /*
+     * Mesh file (relative to the user path) and index of its first point. If empty, the mesh is generated
+     */
+    std::string meshFile;
+    int startIndex = 1;
+
+    /*
+     * Domain, seed point generator and number of seeds in each axis used to generate the mesh. Problems are solved
+     * concurrently, so a generator whose functors keep state between calls (such as ConstantAlternating, or the
+     * random functors) must not be shared with other specifications
+     */
+    Region* region = nullptr;
+    PointGenerator* generator = nullptr;
+    int nX = 0;
+    int nY = 0;
+
+    /*
+     * Material of the domain (each problem works on its own copy, as the discretizations modify it)
+     */
+    Material* material = nullptr;
+
+    /*
+     * Function that adds the essential and natural constraints of the problem, given the mesh points
+     */
+    std::function<void(LinearElasticityConditions*, UniqueList<Point>&)> constraints;
+
+    /*
+     * Exact solution used to compute the L2 norm and H1 seminorm of the error (any of them can be null to skip the
+     * corresponding norm)
+     */
+    DisplacementValue* exactDisplacement = nullptr;
+    StrainValue* exactStrain = nullptr;
+
+    /*
+     * Configuration parameters used while solving this problem
+     */
+    ExecutionContext context;
+
+    /*
+     * File (relative to the user path) where the nodal displacements are written. Empty to skip
+     */
+    std::string displacementsFile;
+};
+
+#endif
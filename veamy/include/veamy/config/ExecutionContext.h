@@ -0,0 +1,64 @@
+#ifndef VEAMY_EXECUTIONCONTEXT_H
+#define VEAMY_EXECUTIONCONTEXT_H
+
+#include <delynoi/config/DelynoiConfig.h>
+#include <veamy/config/VeamyConfig.h>
+#include <feamy/config/FeamyConfig.h>
+
+/*
+ * Class that groups an independent copy of all configuration parameters (geometric tolerance, output precision, VEM
+ * gamma, number of Gauss points, etc) used to run one problem. Activating it for a thread (see ExecutionContextScope)
+ * makes meshing, assembly and post-processing in that thread use its values, so several problems with different
+ * parameters can be solved concurrently in the same process
+ */
+class ExecutionContext {
+private:
+    /*
+     * Configuration of each of the modules
+     */
+    DelynoiConfig delynoiConfig;
+    VeamyConfig veamyConfig;
+    FeamyConfig feamyConfig;
+public:
+    /*
+     * Constructor. Copies the configuration currently used by the calling thread
+     */
+    ExecutionContext();
+
+    /* Sets the tolerance used to compare points and other geometric entities, both in Delynoi and Veamy
+     * @param t value to set
+     */
+    void setTolerance(double t);
+
+    /* Sets the number of decimals used in output files
+     * @param p value to set
+     */
+    void setPrecision(int p);
+
+    /* Sets the value of gamma for the VEM stiffness matrix calculation
+     * @param g value to set
+     */
+    void setGamma(double g);
+
+    /* Sets the number of Gauss points used by FEM
+     * @param gauss value to set
+     */
+    void setNumberOfGaussPoints(int gauss);
+
+    /*
+     * @return the Delynoi configuration of this context
+     */
+    DelynoiConfig* getDelynoiConfig();
+
+    /*
+     * @return the Veamy configuration of this context
+     */
+    VeamyConfig* getVeamyConfig();
+
+    /*
+     * @return the Feamy configuration of this context
+     */
+    FeamyConfig* getFeamyConfig();
+};
+
+#endif
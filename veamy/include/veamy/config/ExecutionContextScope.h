@@ -0,0 +1,46 @@
+#ifndef VEAMY_EXECUTIONCONTEXTSCOPE_H
+#define VEAMY_EXECUTIONCONTEXTSCOPE_H
+
+#include <veamy/config/ExecutionContext.h>
+
+/*
+ * Activates an ExecutionContext for the calling thread during its lifetime, restoring the previously active
+ * configuration when destroyed
+ */
+class ExecutionContextScope {
+private:
+    /*
+     * Configurations active before this scope was created
+     */
+    DelynoiConfig* previousDelynoi;
+    VeamyConfig* previousVeamy;
+    FeamyConfig* previousFeamy;
+
+    /*
+     * Scopes can not be copied, as each one must restore the configuration exactly once
+     */
+    ExecutionContextScope(const ExecutionContextScope& other) = delete;
+    ExecutionContextScope& operator=(const ExecutionContextScope& other) = delete;
+public:
+    /*
+     * Constructor. Activates the context for the calling thread
+     * @param context context to activate (must outlive the scope)
+     */
+    ExecutionContextScope(ExecutionContext& context);
+
+    /*
+     * Constructor. Activates the given configurations for the calling thread, used to run work in other threads with
+     * the configuration of the thread that started it
+     * @param delynoiConfig Delynoi configuration to activate
+     * @param veamyConfig Veamy configuration to activate
+     * @param feamyConfig Feamy configuration to activate
+     */
+    ExecutionContextScope(DelynoiConfig* delynoiConfig, VeamyConfig* veamyConfig, FeamyConfig* feamyConfig);
+
+    /*
+     * Destructor. Restores the previous configuration
+     */
+    ~ExecutionContextScope();
+};
+
+#endif
@@ -4,7 +4,8 @@
 #include <utilities/Precision.h>
 
 /*
- * Class that encapsulates all cnfiguration parameters of the Veamy library
+ * Class that encapsulates all cnfiguration parameters of the Veamy library. As DelynoiConfig, each thread uses the
+ * default instance unless another one is activated for it
  */
 class VeamyConfig{
 private:
@@ -24,15 +25,30 @@ private:
     int precision;
 
     /*
-     * Unique instance of VeamyConfig (following the Singleton pattern)
+     * Configuration activated for the calling thread (null when the thread uses the default one)
      */
-    static VeamyConfig* s_instance;
+    static thread_local VeamyConfig* active;
 
     /*
      * Constructor
      */
     VeamyConfig();
+
+    /*
+     * @return the process wide default instance
+     */
+    static VeamyConfig* defaultInstance();
 public:
+    /*
+     * Copy constructor, used to create independent configurations that can be activated per thread
+     */
+    VeamyConfig(const VeamyConfig& other) = default;
+
+    /*
+     * Assignment operator
+     */
+    VeamyConfig& operator=(const VeamyConfig& other) = default;
+
     /* Sets the value of the tolerance for double precision number comparison
      * @param t value to set
      */
@@ -69,9 +85,17 @@ public:
     int getPrecision();
 
     /*
-     * @return instance of VeamyConfig
+     * @return instance of VeamyConfig used by the calling thread
+     */
+    static VeamyConfig* instance(){
+        return active!=nullptr? active : defaultInstance();
+    }
+
+    /* Activates a configuration for the calling thread. The instance must outlive its activation
+     * @param config configuration to activate (null to go back to the default one)
+     * @return the previously activated configuration (null if it was the default one)
      */
-    static VeamyConfig* instance();
+    static VeamyConfig* activate(VeamyConfig* config);
 };
 
 #endif 
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <veamy/utilities/SegmentPair.h>
 #include <veamy/models/constraints/ConstraintsContainer.h>
+#include <utilities/Profiler.h>
 
 /*
  * Class that contains all the degrees of freedom of the system
@@ -25,6 +26,13 @@ protected:
      * Number of degrees of freedom per point
      */
     int n_dofs;
+
+#ifdef VEAMY_INSTRUMENTATION
+    /*
+     * Time spent matching the new DOFs with the constraints, accumulated over all calls to addDOF
+     */
+    PhaseTimer matchingTimer;
+#endif
 public:
     /*
      * Constructor
@@ -78,6 +86,14 @@ public:
      * @return number of degrees of freedom per point
      */
     int getNumberOfDOFS();
+
+#ifdef VEAMY_INSTRUMENTATION
+    /*
+     * Records the time spent matching DOFs with the constraints since the last call as one execution of the
+     * "constraint matching" phase
+     */
+    void flushProfile();
+#endif
 };
 
 
@@ -38,6 +38,17 @@ public:
      */
     Material();
 
+    /*
+     * Destructor
+     */
+    virtual ~Material() {}
+
+    /*
+     * @return a new copy of this material (so that problems solved concurrently do not share state). Materials that
+     * do not override it throw std::invalid_argument, so they can not be used in a batch
+     */
+    virtual Material* clone();
+
     /*
      * @return the material matrix (also called stress/strain tensor)
      */
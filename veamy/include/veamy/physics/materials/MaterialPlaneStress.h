@@ -18,6 +18,11 @@ public:
      */
     MaterialPlaneStress(double young, double poisson);
 
+    /*
+     * @return a new copy of this material
+     */
+    Material* clone();
+
     /*
     * @return the material matrix (also called stress/strain tensor) for plane stress
     */
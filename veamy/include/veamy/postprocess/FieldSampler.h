@@ -0,0 +1,89 @@
+#ifndef VEAMY_FIELDSAMPLER_H
+#define VEAMY_FIELDSAMPLER_H
+
+#include <delynoi/models/Mesh.h>
+#include <veamy/postprocess/calculators/DisplacementCalculator.h>
+#include <veamy/postprocess/calculators/StrainCalculator.h>
+#include <veamy/postprocess/writers/ResultWriter.h>
+#include <veamy/lib/Eigen/Dense>
+#include <vector>
+
+/*
+ * Fields of the solution that can be sampled on arbitrary points
+ */
+enum class SampledField {Displacement, Strain, Stress};
+
+/*
+ * Class that evaluates the approximated solution of a problem (displacement, strain or stress) on large sets of
+ * arbitrary points, such as raster grids or sensor positions. The points are located in bulk with the point locator of
+ * the mesh, sorted by element, and each element evaluates all its points at once (so the VEM projections or the shape
+ * functions of the element are computed only once), with the elements split among the configured threads. Points
+ * outside the mesh are left undefined
+ */
+template <typename T>
+class FieldSampler {
+private:
+    /*
+     * Mesh on which the solution was computed
+     */
+    Mesh<T>* mesh;
+
+    /*
+     * Calculators of the approximated displacement and strain (not owned, the strain one may be null)
+     */
+    DisplacementCalculator<T>* displacementCalculator;
+    StrainCalculator<T>* strainCalculator;
+
+    /*
+     * Material matrix, used to compute the stress from the strain (empty if the stress can not be sampled)
+     */
+    Eigen::MatrixXd D;
+
+    /* Evaluates a field on several points of the same element
+     * @param field field to evaluate
+     * @param x,y coordinates of the points
+     * @param n number of points
+     * @param element index of the element
+     * @param values vector where the values are set, point after point
+     */
+    void evaluate(SampledField field, const double* x, const double* y, int n, int element,
+                  std::vector<double>& values);
+public:
+    /*
+     * Constructor
+     * @param mesh mesh on which the solution was computed
+     * @param displacements calculator of the approximated displacement
+     * @param strains calculator of the approximated strain (null if the strain is not sampled)
+     * @param D material matrix (empty if the stress is not sampled)
+     */
+    FieldSampler(Mesh<T>& mesh, DisplacementCalculator<T>* displacements, StrainCalculator<T>* strains = nullptr,
+                 Eigen::MatrixXd D = Eigen::MatrixXd());
+
+    /* Samples a field on a set of points. The calculators precompute the data of the elements on each call, so the
+     * values follow changes of the calculators or of the solution between calls
+     * @param field field to sample
+     * @param points points where the field is evaluated
+     * @param values vector where the values are set, point after point (NaN for points outside the mesh)
+     * @param defined vector where it is set whether each point is inside the mesh
+     * @return number of values per point
+     */
+    int sample(SampledField field, const std::vector<Point>& points, std::vector<double>& values,
+               std::vector<char>& defined);
+
+    /* Samples a field on a set of points and sends the values, in blocks of points, to a result writer (with as many
+     * values per point as the field). The writer is not closed
+     * @param field field to sample
+     * @param points points where the field is evaluated
+     * @param writer result writer that receives the values
+     */
+    void sample(SampledField field, const std::vector<Point>& points, ResultWriter& writer);
+
+    /* Creates the points of a regular raster grid, row after row (from the bottom row, each one from left to right)
+     * @param xMin,yMin,xMax,yMax bounds of the grid
+     * @param nX,nY number of points in each axis
+     * @return points of the grid
+     */
+    static std::vector<Point> grid(double xMin, double yMin, double xMax, double yMax, int nX, int nY);
+};
+
+#endif
@@ -14,17 +14,42 @@ private:
      * Pointer to the function that represents the solution
      */
     func_pair f;
+
+    /*
+     * Pointer to a function that writes the solution to a buffer (used instead of f when it is set)
+     */
+    func_pair_buffer fBuffer;
+
+    /*
+     * Number of components written by fBuffer
+     */
+    int components;
 public:
     /*
      * Constructor
      */
     DisplacementValue(func_pair f);
 
+    /*
+     * Constructor. The solution writes its components to a buffer, so evaluating it on several points allocates nothing
+     * @param f function that writes the solution
+     * @param components number of components of the solution
+     */
+    DisplacementValue(func_pair_buffer f, int components);
+
     /* Evaluates the solution function at a given point
      * @param p point to evaluate on
      * @return value of the real displacement on p
      */
     std::vector<double> getValue(Point p);
+
+    /* Evaluates the solution function at several points
+     * @param x,y coordinates of the points
+     * @param n number of points
+     * @param values vector where the values are set, point after point (it is resized to n times the number of
+     * components, so its memory is reused between calls)
+     */
+    void getValues(const double* x, const double* y, int n, std::vector<double>& values);
 };
 
 #endif
\ No newline at end of file
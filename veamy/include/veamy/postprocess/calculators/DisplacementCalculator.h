@@ -20,6 +20,32 @@ protected:
      * Nodal displacement results
      */
     Eigen::VectorXd nodalValues;
+
+    /*
+     * Hash of each element whose data was precomputed by the last call to prepare, so that the data is only used for
+     * the same element (and not for another mesh integrated later with the same calculator)
+     */
+    std::vector<std::size_t> preparedElements;
+
+    /* Discards the previously precomputed elements and records the ones that prepare is about to precompute
+     * @param elements elements of the mesh
+     */
+    void setPreparedElements(std::vector<T>& elements){
+        this->preparedElements.resize(elements.size());
+        for (int i = 0; i < (int) elements.size(); ++i) {
+            this->preparedElements[i] = elements[i].hash;
+        }
+    }
+
+    /* Checks if the data of an element was precomputed by the last call to prepare
+     * @param container element
+     * @param containerIndex index of the element
+     * @return whether the precomputed data of containerIndex belongs to container
+     */
+    bool isPrepared(T& container, int containerIndex) const{
+        return containerIndex >= 0 && containerIndex < (int) this->preparedElements.size() &&
+               this->preparedElements[containerIndex]==container.hash;
+    }
 public:
     /*
      * Constructor
@@ -34,6 +60,24 @@ public:
      */
     virtual std::vector<double> getDisplacement(double x, double y, int index, T container) = 0;
 
+    /* Computes the approximate displacement for several points of the same element. By default getDisplacement is
+     * called on each point; implementations that override it must not modify the calculator, as the norms are
+     * integrated from several threads at once
+     * @param x,y coordinates of the points
+     * @param n number of points
+     * @param container element that contains the points
+     * @param containerIndex index of the container element
+     * @param values vector where the displacements are set, point after point (it is resized to n times the number of
+     * degrees of freedom per point, so its memory is reused between calls)
+     */
+    virtual void getDisplacements(const double* x, const double* y, int n, T& container, int containerIndex,
+                                  std::vector<double>& values);
+
+    /* Precomputes the data of each element used by getDisplacements, before the norms of a mesh are integrated
+     * @param elements elements of the mesh
+     */
+    virtual void prepare(std::vector<T>&){}
+
     /* Sets the index of the polygon in which the next points will be contained
      * @param polyIndex index of the polygon
      */
@@ -9,6 +9,11 @@
  */
 template <typename T>
 class VeamyElasticityStrainCalculator : public StrainCalculator<T>{
+private:
+    /*
+     * Constant strain of each element, set by prepare (3 values per element)
+     */
+    std::vector<double> strains;
 public:
     /*
      * Constructor
@@ -22,6 +27,22 @@ public:
      * @return approximated strain
      */
     Eigen::VectorXd getStrain(double x, double y, T container, int containerIndex);
+
+    /* Computes the approximate strain for several points of the same element (the strain is constant in each element,
+     * so it is computed once)
+     * @param x,y coordinates of the points
+     * @param n number of points
+     * @param container element that contains the points
+     * @param containerIndex index of the container element
+     * @param values vector where the strains are set, point after point
+     */
+    void getStrains(const double* x, const double* y, int n, T& container, int containerIndex,
+                    std::vector<double>& values);
+
+    /* Computes the strain of every element, in parallel
+     * @param elements elements of the mesh
+     */
+    void prepare(std::vector<T>& elements);
 };
 
 #endif
\ No newline at end of file
@@ -15,6 +15,18 @@ private:
      * Mesh points
      */
     std::vector<Point> points;
+
+    /*
+     * Projection of the solution on each element, set by prepare (five values per element, see projection)
+     */
+    std::vector<double> projections;
+
+    /* Computes the projection of the solution on an element
+     * @param container element
+     * @param values array where the center of the element (two values), the gradient of the projection (two) and the
+     * mean nodal value (one) are set
+     */
+    void projection(T& container, double* values);
 public:
     /*
      * Constructor
@@ -28,6 +40,22 @@ public:
      * @return approximated displacement
      */
     std::vector<double> getDisplacement(double x, double y, int index, T container);
+
+    /* Computes the approximate displacement for several points of the same element, computing the projection of the
+     * element only once
+     * @param x,y coordinates of the points
+     * @param n number of points
+     * @param container element that contains the points
+     * @param containerIndex index of the container element
+     * @param values vector where the displacements are set, point after point
+     */
+    void getDisplacements(const double* x, const double* y, int n, T& container, int containerIndex,
+                          std::vector<double>& values);
+
+    /* Computes the projection of the solution on every element, in parallel
+     * @param elements elements of the mesh
+     */
+    void prepare(std::vector<T>& elements);
 };
 
 #endif
\ No newline at end of file
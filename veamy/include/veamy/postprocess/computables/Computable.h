@@ -1,6 +1,8 @@
 #ifndef VEAMY_COMPUTABLE_H
 #define VEAMY_COMPUTABLE_H
 
+#include <vector>
+
 /*
  * Abstract class that models the calculations of the minimal terms of the norms (the values inside the integrals, that
  * later are numerically integrated)
@@ -8,6 +10,8 @@
 template <typename T>
 class Computable {
 public:
+    virtual ~Computable(){}
+
     /* Calculates the value of this particular computable on a point
      * @param x y coordinates of the point
      * @param index index of the point (if part of the mesh)
@@ -16,10 +20,37 @@ public:
      */
     virtual double apply(double x, double y, int index, T container) = 0;
 
+    /* Calculates the value of this computable on several points of the same container. By default apply is called on
+     * each point; computables override it so the work related to the container is done once, and nothing is copied or
+     * allocated per point
+     * @param x,y coordinates of the points
+     * @param n number of points
+     * @param container geometric container of the points
+     * @param values array (with n elements) where the values will be set
+     */
+    virtual void applyBatch(const double* x, const double* y, int n, T& container, double* values){
+        for (int i = 0; i < n; ++i) {
+            values[i] = apply(x[i], y[i], 0, container);
+        }
+    }
+
     /* Sets the index of the polygon in which the next points will be contained
      * @param polyIndex index of the polygon
      */
     virtual void setPolygonIndex(int polyIndex){}
+
+    /* Precomputes the data of each element used by the computable, before the elements are integrated
+     * @param elements elements of the mesh
+     */
+    virtual void prepare(std::vector<T>&){}
+
+    /* Creates a copy of the computable that can be used at the same time as this one, from another thread (so it
+     * has its own memory, but shares the calculators, which are only read)
+     * @return pointer to a new Computable instance, or nullptr if the computable can only be used from one thread
+     */
+    virtual Computable<T>* clone(){
+        return nullptr;
+    }
 };
 
 #endif
\ No newline at end of file
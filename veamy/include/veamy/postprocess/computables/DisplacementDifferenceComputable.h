@@ -37,6 +37,12 @@ private:
      * Index of the polygon that contains the points in which the points are contained
      */
     int polygonIndex;
+
+    /*
+     * Exact and approximated displacements of the points of an element, kept so that applyBatch reuses their memory
+     */
+    std::vector<double> exact;
+    std::vector<double> approximate;
 public:
     /*
      * Constructor
@@ -51,10 +57,28 @@ public:
      */
     double apply(double x, double y, int index, T container);
 
+    /* Computes the value of the term in several points of the same element
+     * @param x,y coordinates of the points
+     * @param n number of points
+     * @param container element that contains the points
+     * @param values array where the values will be set
+     */
+    void applyBatch(const double* x, const double* y, int n, T& container, double* values);
+
     /* Sets the index of the polygon in which the next points will be contained
     * @param polyIndex index of the polygon
     */
     void setPolygonIndex(int polyIndex);
+
+    /* Precomputes the approximated displacement of each element
+     * @param elements elements of the mesh
+     */
+    void prepare(std::vector<T>& elements);
+
+    /*
+     * @return copy of the computable
+     */
+    Computable<T>* clone();
 };
 
 #endif
\ No newline at end of file
@@ -28,6 +28,19 @@ public:
      * @return value of the computable
      */
     double apply(double x, double y, int index, Polygon container);
+
+    /* Calculates the value of the function on several points (the container is not used, so it is not copied)
+     * @param x,y coordinates of the points
+     * @param n number of points
+     * @param container geometric container of the points
+     * @param values array where the values will be set
+     */
+    void applyBatch(const double* x, const double* y, int n, Polygon& container, double* values);
+
+    /*
+     * @return copy of the computable
+     */
+    Computable<Polygon>* clone();
 };
 
 #endif
\ No newline at end of file
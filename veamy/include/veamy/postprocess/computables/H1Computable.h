@@ -18,7 +18,34 @@ protected:
     /*
      * Class in charge of computing the approximated strain
      */
-    StrainCalculator<T>* calculator;
+    StrainCalculator<T>* calculator = nullptr;
+
+    /*
+     * Exact and approximated values of the points of an element, kept so that applyBatch reuses their memory
+     */
+    std::vector<double> exact;
+    std::vector<double> exactStress;
+    std::vector<double> approximate;
+
+    /* Computes the product e'*D*e, in the same order as the Eigen expression used on a single point
+     * @param e strain (with as many components as rows in D)
+     * @return value of the product
+     */
+    double materialProduct(const double* e){
+        int n = (int) this->D.rows();
+        double result = 0;
+
+        for (int j = 0; j < n; ++j) {
+            double eD = 0;
+            for (int i = 0; i < n; ++i) {
+                eD += e[i]*this->D(i,j);
+            }
+
+            result += eD*e[j];
+        }
+
+        return result;
+    }
 public:
     /* Sets the value of the material matrix for stress computation from strain
      * @param D material matrix
@@ -33,6 +60,15 @@ public:
     void setCalculator(StrainCalculator<T>* calculator){
         this->calculator = calculator;
     };
+
+    /* Precomputes the approximated strain of each element (if the computable uses it)
+     * @param elements elements of the mesh
+     */
+    void prepare(std::vector<T>& elements){
+        if(this->calculator!=nullptr){
+            this->calculator->prepare(elements);
+        }
+    }
 };
 
 #endif
\ No newline at end of file
@@ -29,10 +29,23 @@ public:
      */
     double apply(double x, double y, int index, T container);
 
+    /* Computes the value of the term in several points of the same element
+     * @param x,y coordinates of the points
+     * @param n number of points
+     * @param container element that contains the points
+     * @param values array where the values will be set
+     */
+    void applyBatch(const double* x, const double* y, int n, T& container, double* values);
+
     /* Sets the index of the polygon in which the next points will be contained
      * @param polyIndex index of the polygon
      */
     void setPolygonIndex(int polyIndex);
+
+    /*
+     * @return copy of the computable
+     */
+    Computable<T>* clone();
 };
 
 #endif
\ No newline at end of file
@@ -1,9 +1,11 @@
 #ifndef VEAMY_NORMINTEGRATOR_H
 #define VEAMY_NORMINTEGRATOR_H
 
+#include <memory>
 #include <vector>
 #include <delynoi/models/basic/Point.h>
 #include <veamy/postprocess/computables/Computable.h>
+#include <veamy/postprocess/integrator/QuadratureCache.h>
 
 /*
  * Abstract class that models the process of computing the integral in each norm
@@ -14,8 +16,21 @@ protected:
     /*
      * Computable that will be integrated
      */
-    Computable<T> *computable;
+    Computable<T> *computable = nullptr;
+
+    /*
+     * Precomputed quadrature points of the mesh (shared with the calculator that computed them, so they stay valid
+     * even if the calculator replaces its cache); when not set, the points are computed in each call
+     */
+    std::shared_ptr<QuadratureCache<T>> quadrature;
+
+    /*
+     * Values of the computable on the points of an element, kept so that its memory is reused
+     */
+    std::vector<double> values;
 public:
+    virtual ~NormIntegrator(){}
+
     /* Computes the numerical integral value depending on the integration scheme implemented
      * @param poly polygon inside which the integral must be computed
      * @param polyIndex index of poly
@@ -29,6 +44,20 @@ public:
      */
     virtual void setComputable(Computable<T>* c) = 0;
 
+    /*
+     * @return computable that is integrated (nullptr if the integrator does not use one)
+     */
+    Computable<T>* getComputable(){
+        return this->computable;
+    }
+
+    /* Sets the precomputed quadrature points to use (they must be computed for the mesh that will be integrated)
+     * @param q quadrature cache
+     */
+    void setQuadrature(std::shared_ptr<QuadratureCache<T>> q){
+        this->quadrature = q;
+    }
+
     /* Clones the instance, creating an identical copy in other memory space
      * @return pointer to a new NormIntegrator instance
      */
@@ -0,0 +1,123 @@
+#ifndef VEAMY_QUADRATURECACHE_H
+#define VEAMY_QUADRATURECACHE_H
+
+#include <delynoi/models/Mesh.h>
+#include <delynoi/models/polygon/Triangle.h>
+#include <vector>
+
+/*
+ * Way in which the elements are split in triangles to place the quadrature points
+ */
+enum class ElementTriangulation {
+    /*
+     * Triangles around the center for convex elements and ear clipping otherwise, using a local copy of the element
+     * points (as done by veamy_functions::gauss_integration)
+     */
+    Center,
+
+    /*
+     * Ear clipping of the element on the mesh points (as done by AreaIntegrator with a VeamyPolygon)
+     */
+    Ears
+};
+
+/*
+ * Physical quadrature points and weights of every element of a mesh, computed once (in parallel) for a given order and
+ * reused by all the integrands. The points are stored as separate arrays of coordinates and weights, contiguous for
+ * each element; each sub-triangle holds as many consecutive points as its reference rule. The values are the same, bit
+ * for bit, as those computed on the fly by gauss_quadrature::triangle_rules
+ */
+template <typename T>
+class QuadratureCache {
+private:
+    /*
+     * Key of the cache: mesh (and its size), order of the quadrature and triangulation
+     */
+    const Mesh<T>* mesh;
+    int numberOfPolygons;
+    int numberOfPoints;
+    int order;
+    ElementTriangulation triangulation;
+
+    /*
+     * Points of the triangle rule
+     */
+    int trianglePoints;
+
+    /*
+     * First sub-triangle of each element (with one extra entry, the total number of sub-triangles)
+     */
+    std::vector<int> triangleOffsets;
+
+    /*
+     * Sub-triangles (on the mesh points), only kept for the Ears triangulation: the Center triangulation uses the
+     * center of the element, which is not a mesh point
+     */
+    std::vector<Triangle> triangles;
+
+    /*
+     * Coordinates and weights of the quadrature points of the elements
+     */
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> w;
+public:
+    /*
+     * Constructor. Computes the quadrature points of all the elements of a mesh
+     * @param mesh mesh to integrate
+     * @param order order of the quadrature (from 1 to 5)
+     * @param triangulation way in which the elements are split in triangles
+     */
+    QuadratureCache(Mesh<T>& mesh, int order, ElementTriangulation triangulation);
+
+    /* Checks if the cache was computed for the given parameters (so it can be reused)
+     * @param mesh mesh to integrate
+     * @param order order of the quadrature
+     * @param triangulation way in which the elements are split in triangles
+     * @return whether the cache can be used
+     */
+    bool isBuiltFor(Mesh<T>& mesh, int order, ElementTriangulation triangulation) const;
+
+    /*
+     * @return number of quadrature points of each sub-triangle
+     */
+    int pointsPerTriangle() const;
+
+    /*
+     * @param element index of the element
+     * @return first sub-triangle of the element
+     */
+    int firstTriangle(int element) const;
+
+    /*
+     * @param element index of the element
+     * @return one past the last sub-triangle of the element
+     */
+    int endTriangle(int element) const;
+
+    /*
+     * @param element index of the element
+     * @return first quadrature point of the element
+     */
+    int firstPoint(int element) const;
+
+    /*
+     * @param element index of the element
+     * @return one past the last quadrature point of the element
+     */
+    int endPoint(int element) const;
+
+    /*
+     * @return sub-triangles of the elements (empty for the Center triangulation)
+     */
+    const std::vector<Triangle>& getTriangles() const;
+
+    /*
+     * @return coordinates and weights of the quadrature points of the elements
+     */
+    const double* getX() const;
+    const double* getY() const;
+    const double* getWeights() const;
+};
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef VEAMY_RESULTWRITER_H
+#define VEAMY_RESULTWRITER_H
+
+#include <utilities/BufferedWriter.h>
+#include <string>
+#include <vector>
+
+/*
+ * Supported formats for nodal results files. Text writes one line per point with the point index followed by its
+ * values; Binary writes a header with the number of points and values per point (two int32) followed by the raw
+ * float64 values in point order (NaN for points without degrees of freedom)
+ */
+enum class ResultFormat {Text, Binary};
+
+/*
+ * Block of consecutive points with their nodal values, the unit of work of the result writers
+ */
+struct NodeBlock {
+    /*
+     * Index of the first point of the block
+     */
+    int first;
+
+    /*
+     * Nodal values, stored point by point (number of values per point is defined by the writer)
+     */
+    std::vector<double> values;
+
+    /*
+     * Whether each point of the block has associated values
+     */
+    std::vector<char> defined;
+
+    /*
+     * @return number of points of the block
+     */
+    int size() const { return (int) defined.size(); }
+};
+
+/*
+ * Class that writes nodal results (displacements, scalar fields, etc) to a file, block by block, through a buffered
+ * writer
+ */
+class ResultWriter {
+protected:
+    /*
+     * Buffered file writer
+     */
+    BufferedWriter writer;
+
+    /*
+     * Format of the file
+     */
+    ResultFormat format;
+
+    /*
+     * Number of values per point
+     */
+    int n_dofs;
+
+    /*
+     * Number of decimals used in text mode
+     */
+    int precision;
+
+    /*
+     * Whether the file was already closed
+     */
+    bool closed;
+
+    /* Formats and writes a block of points
+     * @param block block to write
+     */
+    void writeToFile(const NodeBlock& block);
+public:
+    /*
+     * Number of points per block used when splitting results
+     */
+    static const int BLOCK_SIZE = 1 << 14;
+
+    /*
+     * Constructor. Opens the file and, in binary mode, writes the header
+     * @param fileName name of the file (relative to the user path, as with the rest of the library)
+     * @param format format of the file
+     * @param n_dofs number of values per point
+     * @param numberOfPoints total number of points that will be written
+     * @param precision number of decimals used in text mode
+     */
+    ResultWriter(std::string fileName, ResultFormat format, int n_dofs, int numberOfPoints, int precision);
+
+    /*
+     * Destructor
+     */
+    virtual ~ResultWriter();
+
+    /* Writes a block of points. Blocks must be given in point order. Throws std::invalid_argument if the writer was
+     * already closed
+     * @param block block to write
+     */
+    virtual void write(NodeBlock& block);
+
+    /*
+     * Writes all pending data and closes the file
+     */
+    virtual void close();
+
+    /*
+     * @return number of values per point
+     */
+    int getNumberOfDOFS();
+};
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef VEAMY_STREAMINGRESULTWRITER_H
+#define VEAMY_STREAMINGRESULTWRITER_H
+
+#include <veamy/postprocess/writers/ResultWriter.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+/*
+ * Result writer that formats and writes the blocks in a background thread, so that the caller can continue with
+ * later phases (norm computation, other output) while the file is written. The number of queued blocks is bounded,
+ * so memory usage does not grow with the size of the results
+ */
+class StreamingResultWriter : public ResultWriter {
+private:
+    /*
+     * Background thread that consumes the queued blocks
+     */
+    std::thread worker;
+
+    /*
+     * Blocks pending to be written, and synchronization primitives protecting them
+     */
+    std::deque<NodeBlock> queue;
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+
+    /*
+     * Maximum number of blocks waiting in the queue
+     */
+    size_t maxQueued;
+
+    /*
+     * Whether no more blocks will be received
+     */
+    bool finished;
+
+    /*
+     * Main loop of the background thread
+     */
+    void run();
+public:
+    /*
+     * Constructor. Opens the file and starts the background thread
+     * @param fileName name of the file (relative to the user path)
+     * @param format format of the file
+     * @param n_dofs number of values per point
+     * @param numberOfPoints total number of points that will be written
+     * @param precision number of decimals used in text mode
+     * @param maxQueued maximum number of blocks waiting to be written
+     */
+    StreamingResultWriter(std::string fileName, ResultFormat format, int n_dofs, int numberOfPoints, int precision,
+                          size_t maxQueued = 8);
+
+    /*
+     * Destructor. Waits for the pending blocks to be written
+     */
+    ~StreamingResultWriter();
+
+    /* Queues a block to be written, blocking only if the queue is full. The contents of block are moved. Throws
+     * std::invalid_argument if the writer was already closed
+     * @param block block to write
+     */
+    void write(NodeBlock& block);
+
+    /*
+     * Waits until all queued blocks are written and closes the file
+     */
+    void close();
+};
+
+#endif
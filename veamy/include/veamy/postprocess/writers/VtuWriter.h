@@ -0,0 +1,100 @@
+#ifndef VEAMY_VTUWRITER_H
+#define VEAMY_VTUWRITER_H
+
+#include <delynoi/models/Mesh.h>
+#include <veamy/lib/Eigen/Dense>
+#include <veamy/models/dof/DOFS.h>
+#include <veamy/physics/materials/Material.h>
+#include <veamy/postprocess/calculators/StrainCalculator.h>
+#include <string>
+#include <vector>
+
+/*
+ * Class that exports a mesh, and nodal and element fields defined on it, to a VTK unstructured grid file (.vtu) that
+ * can be opened directly in ParaView. All arrays are stored as appended raw binary data, optionally compressed using
+ * the zlib-compatible run-length compressor of the utilities library
+ */
+template <typename T>
+class VtuWriter {
+private:
+    /*
+     * Data array (field, coordinates or topology) to be written
+     */
+    struct DataArray {
+        std::string name;
+        std::string type;
+        int components;
+        std::vector<unsigned char> bytes;
+    };
+
+    /*
+     * Mesh to export
+     */
+    Mesh<T>& mesh;
+
+    /*
+     * Whether the arrays are compressed
+     */
+    bool compressed;
+
+    /*
+     * Nodal and element fields added to the file
+     */
+    std::vector<DataArray> pointFields;
+    std::vector<DataArray> cellFields;
+
+    /* Creates a Float64 data array from a list of values
+     * @param name name of the array
+     * @param components number of components per tuple
+     * @param values values of the array
+     */
+    static DataArray fromDoubles(std::string name, int components, const std::vector<double>& values);
+
+    /* Encodes an array as it is stored in the appended section (header followed by the data)
+     * @param array array to encode
+     * @param out vector where the encoded array is appended
+     */
+    void encode(DataArray& array, std::vector<unsigned char>& out);
+public:
+    /*
+     * Constructor
+     * @param mesh mesh to export
+     * @param compressed whether to compress the arrays
+     */
+    VtuWriter(Mesh<T>& mesh, bool compressed = false);
+
+    /* Adds a nodal field
+     * @param name name of the field
+     * @param components number of components per point
+     * @param values values of the field, point by point
+     */
+    void addPointField(std::string name, int components, const std::vector<double>& values);
+
+    /* Adds an element field
+     * @param name name of the field
+     * @param components number of components per element
+     * @param values values of the field, element by element
+     */
+    void addCellField(std::string name, int components, const std::vector<double>& values);
+
+    /* Adds the nodal values computed by Veamer or Feamer. Vectorial results with two components are written with
+     * three (z equal to zero) so they can be used directly to warp the mesh
+     * @param dofs degrees of freedom of the system
+     * @param u computed nodal values
+     * @param name name of the field
+     */
+    void addDisplacements(DOFS& dofs, Eigen::VectorXd& u, std::string name = "Displacement");
+
+    /* Adds the strain of each element, evaluated in its centroid, and, if a material is given, the associated stress
+     * @param calculator strain calculator of the problem
+     * @param material material of the problem (can be null, for example, for Poisson problems)
+     */
+    void addStrainAndStress(StrainCalculator<T>* calculator, Material* material);
+
+    /* Writes the file
+     * @param fileName name of the file (relative to the user path, as with the rest of the library)
+     */
+    void write(std::string fileName);
+};
+
+#endif
@@ -7,5 +7,6 @@
  */
 typedef double(*func)(double, double);
 typedef std::vector<double>(*func_pair)(double, double);
+typedef void(*func_pair_buffer)(double, double, double*);
 
 #endif
\ No newline at end of file
@@ -6,8 +6,8 @@
 #include <veamy/utilities/functions_types.h>
 #include <veamy/postprocess/computables/Computable.h>
 #include <veamy/lib/Eigen/Dense>
-#include <delynoi/triangulation/CenterTriangulationGenerator.h>
-#include <delynoi/triangulation/EarTriangulationGenerator.h>
+#include <delynoi/models/polygon/Triangle.h>
+#include <delynoi/triangulation/EarClipper.h>
 #include <feamy/integration/quadrature/gauss_quadrature.h>
 #include <veamy/postprocess/utilities/norm_utilities.h>
 #include <utilities/Trio.h>
@@ -77,31 +77,45 @@ namespace veamy_functions{
         return result;
     }
 
-    /* Computes a numerical integral approximation using a Gaussian scheme
+    /* Computes a numerical integral approximation using a Gaussian scheme. Convex polygons are split in triangles
+     * around their center, and non convex ones by ear clipping; the triangles reference a local copy of the polygon
+     * points (plus the center), so the mesh points are not modified
      * @param poly polygon in which the integral will be computed
      * @param points mesh points
      */
     template <typename T>
     double gauss_integration(T poly, std::vector<Point>& points, int nGauss, Computable<T>* computable){
-        std::vector<Triangle> triangles;
+        std::vector<Point> polygonPoints = poly.getPoints(points);
+        int n = (int) polygonPoints.size();
+        std::vector<Trio<int>> triangles;
         double result = 0;
 
         if(poly.isConvex(points)){
-            triangles = CenterTriangulationGenerator().triangulate(poly, points);
+            polygonPoints.push_back(poly.getAverage(points));
+            for (int i = 0; i < n; ++i) {
+                triangles.push_back(Trio<int>(i, (i + 1)%n, n));
+            }
         } else {
-            triangles = EarTriangulationGenerator().triangulate(poly, points);
+            std::vector<int> local(n);
+            for (int i = 0; i < n; ++i) {
+                local[i] = i;
+            }
+            triangles = EarClipper().triangulate(local, polygonPoints);
         }
 
-        for (Triangle t: triangles){
-            Eigen::MatrixXd gaussPoints;
-            std::vector<double> weights;
+        gauss_quadrature::TriangleRule rule = gauss_quadrature::triangle_rule(nGauss);
+        std::vector<double> x(rule.size), y(rule.size), weights(rule.size), values(rule.size);
 
-            gauss_quadrature::triangle_rules(gaussPoints, t, weights, nGauss, points);
+        for (Trio<int>& indexes: triangles){
+            Triangle t({indexes.first, indexes.second, indexes.third}, polygonPoints);
+            Eigen::MatrixXd triangle = gauss_quadrature::trianglePoints(t, polygonPoints);
 
-            for (int i = 0; i < weights.size(); ++i) {
-                Point p = Point(gaussPoints(i,0), gaussPoints(i,1));
+            gauss_quadrature::map_triangle_rule(rule, triangle, t.getArea(polygonPoints), x.data(), y.data(),
+                                                weights.data());
 
-                result += computable->apply(p.getX(), p.getY(), 0, poly)*weights[i];
+            computable->applyBatch(x.data(), y.data(), rule.size, poly, values.data());
+            for (int i = 0; i < rule.size; ++i) {
+                result += values[i]*weights[i];
             }
         }
 
@@ -4,6 +4,21 @@
 #include <utilities/UniqueList.h>
 #include <veamy/config/VeamyConfig.h>
 #include <veamy/models/Element.h>
+#include <utilities/Profiler.h>
+#include <feamy/config/FeamyConfig.h>
+#include <delynoi/config/DelynoiConfig.h>
+
+namespace {
+    /*
+     * SparseLU exposing the number of non zeros of its factors, used to measure the fill-in
+     */
+    class SparseLUFactorization : public Eigen::SparseLU<Eigen::SparseMatrix<double>> {
+    public:
+        long long factorNonZeros() const {
+            return (long long) this->m_nnzL + this->m_nnzU;
+        }
+    };
+}
 
 template <typename T>
 Calculator2D<T>::Calculator2D(Conditions *problem, int n_dofs) {
@@ -28,42 +43,67 @@ UniqueList <Point> Calculator2D<T>::getPoints() {
 
 template <typename T>
 void Calculator2D<T>::writeDisplacements(std::string fileName, Eigen::VectorXd &u) {
-    int dofs = this->DOFs.getNumberOfDOFS();
-    
-    std::string path = utilities::getPath();
-    path = path  + fileName;
+    writeDisplacements(fileName, u, ResultFormat::Text);
+}
 
-    std::ofstream file;
-    file.open(path, std::ios::out);
+template <typename T>
+void Calculator2D<T>::writeDisplacements(std::string fileName, Eigen::VectorXd &u, ResultFormat format) {
+    PROFILE_PHASE("output");
+    ResultWriter writer(fileName, format, this->DOFs.getNumberOfDOFS(), this->points.size(),
+                        VeamyConfig::instance()->getPrecision());
+
+    writeDisplacements(writer, u);
+    writer.close();
+}
+
+template <typename T>
+void Calculator2D<T>::writeDisplacements(ResultWriter &writer, Eigen::VectorXd &u) {
+    int dofs = this->DOFs.getNumberOfDOFS();
+    int n = this->points.size();
 
-    std::vector<std::string> results(this->points.size());
+    bool original = !this->pointPermutation.empty() && DelynoiConfig::instance()->useOriginalNumbering();
 
+    std::vector<int> firstDOF(n, -1);
     for (int k = 0; k < u.rows(); k = k + dofs) {
-        int point_index = DOFs.get(k).pointIndex();
+        int point = DOFs.get(k).pointIndex();
+        firstDOF[original? this->pointPermutation[point] : point] = k;
+    }
+
+    for (int first = 0; first < n; first += ResultWriter::BLOCK_SIZE) {
+        int blockSize = std::min(ResultWriter::BLOCK_SIZE, n - first);
 
-        results[point_index] = utilities::toString<int>(point_index);
+        NodeBlock block;
+        block.first = first;
+        block.values.resize(blockSize*dofs);
+        block.defined.resize(blockSize);
 
-        for (int i = 0; i < dofs; ++i) {
-            double def = u[k + i];
+        for (int i = 0; i < blockSize; ++i) {
+            int k = firstDOF[first + i];
+            block.defined[i] = k >= 0;
 
-            results[point_index] += " " +
-                    utilities::toStringWithPrecision(def, VeamyConfig::instance()->getPrecision());
+            for (int j = 0; j < dofs && k >= 0; ++j) {
+                block.values[dofs*i + j] = u[k + j];
+            }
         }
-    }
 
-    for (std::string s: results){
-        file << s << std::endl;
+        writer.write(block);
     }
-
-    file.close();
 }
 
 template <typename T>
 void Calculator2D<T>::assemble(Eigen::MatrixXd &Kglobal, Eigen::VectorXd &fGlobal) {
+    PROFILE_TIMER(kernels, "element kernels");
+    PROFILE_TIMER(assembly, "assembly");
+
     for (Element<T>* e: elements){
+        PROFILE_RESUME(kernels);
         e->computeK(DOFs, this->points);
         e->computeF(DOFs, this->points, conditions);
+        PROFILE_PAUSE(kernels);
+
+        PROFILE_RESUME(assembly);
         e->assemble(DOFs, Kglobal, fGlobal);
+        PROFILE_PAUSE(assembly);
     }
 }
 
@@ -78,34 +118,58 @@ Eigen::VectorXd Calculator2D<T>::simulate(Mesh<T> &mesh) {
 
     assemble(K, f);
 
+    return solve(K, f);
+}
+
+template <typename T>
+Eigen::VectorXd Calculator2D<T>::solve(Eigen::MatrixXd &K, Eigen::VectorXd &f) {
+    int n = this->DOFs.size();
+
     //Apply constrained_points
-    EssentialConstraints essential = this->conditions->constraints.getEssentialConstraints();
-    std::vector<int> c = essential.getConstrainedDOF();
+    {
+        PROFILE_PHASE("bc application");
+        EssentialConstraints essential = this->conditions->constraints.getEssentialConstraints();
+        std::vector<int> c = essential.getConstrainedDOF();
 
-    UniqueList<DOF> dofs = this->DOFs.getDOFS();
-    Eigen::VectorXd boundary_values = essential.getBoundaryValues(this->points.getList(), dofs);
+        UniqueList<DOF> dofs = this->DOFs.getDOFS();
+        Eigen::VectorXd boundary_values = essential.getBoundaryValues(this->points.getList(), dofs);
 
-    for (int j = 0; j < c.size(); ++j) {
-        for (int i = 0; i < K.rows(); ++i) {
-            f(i) = f(i) - (K(i,c[j])*boundary_values(j));
+        for (int j = 0; j < c.size(); ++j) {
+            for (int i = 0; i < K.rows(); ++i) {
+                f(i) = f(i) - (K(i,c[j])*boundary_values(j));
 
-            K(c[j],i) = 0;
-            K(i,c[j]) = 0;
-        }
+                K(c[j],i) = 0;
+                K(i,c[j]) = 0;
+            }
 
-        K(c[j], c[j]) = 1;
-        f(c[j]) = boundary_values(j);
+            K(c[j], c[j]) = 1;
+            f(c[j]) = boundary_values(j);
+        }
     }
 
-
     // solve the system of linear equations
-    std::vector<Eigen::Triplet<double>> coeffs;
-    fromDenseToSparse(K, coeffs);
     Eigen::SparseMatrix<double> sparseK(n,n);
-    sparseK.setFromTriplets(coeffs.begin(), coeffs.end());
+    {
+        PROFILE_PHASE("assembly");
+        std::vector<Eigen::Triplet<double>> coeffs;
+        fromDenseToSparse(K, coeffs);
+        sparseK.setFromTriplets(coeffs.begin(), coeffs.end());
+    }
 
-    Eigen::SparseLU<Eigen::SparseMatrix<double>> chol(sparseK);
-    Eigen::VectorXd x = chol.solve(f);
+    SparseLUFactorization chol;
+    {
+        PROFILE_PHASE("factorization");
+        chol.analyzePattern(sparseK);
+        chol.factorize(sparseK);
+    }
+    PROFILE_COUNTER("factorization", "nnz", sparseK.nonZeros());
+    PROFILE_COUNTER("factorization", "fill-in", chol.factorNonZeros() - sparseK.nonZeros());
+
+    Eigen::VectorXd x;
+    {
+        PROFILE_PHASE("solve");
+        x = chol.solve(f);
+    }
 
     return x;
 }
@@ -123,5 +187,16 @@ void Calculator2D<T>::fromDenseToSparse(Eigen::MatrixXd &K, std::vector<Eigen::T
     K.resize(0,0);
 }
 
+template <typename T>
+std::shared_ptr<QuadratureCache<T>> Calculator2D<T>::getQuadrature(Mesh<T> &mesh, ElementTriangulation triangulation) {
+    int order = FeamyConfig::instance()->getNumberOfGaussPoints();
+
+    if(!this->quadrature || !this->quadrature->isBuiltFor(mesh, order, triangulation)){
+        this->quadrature = std::make_shared<QuadratureCache<T>>(mesh, order, triangulation);
+    }
+
+    return this->quadrature;
+}
+
 template class Calculator2D<Polygon>;
 template class Calculator2D<Triangle>;
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <veamy/Veamer.h>
+#include <utilities/Profiler.h>
 
 Veamer::Veamer(ProblemDiscretization<Polygon,Veamer>* problem) :
         Calculator2D(problem->getConditions(), problem->numberOfDOFs()) {
@@ -13,14 +14,23 @@ Mesh<Polygon> Veamer::initProblemFromFile(std::string fileName) {
 }
 
 void Veamer::initProblem(const Mesh<Polygon> &m) {
+    PROFILE_PHASE("dof creation");
     std::vector<Point> meshPoints = m.getPoints().getList();
     this->points.push_list(meshPoints);
+    this->pointPermutation = m.getPointPermutation();
+    this->quadrature.reset();
 
     std::vector<Polygon> polygons = m.getPolygons();
 
     for(int i=0;i<polygons.size();i++){
         this->elements.push_back(this->problem->createElement(this, polygons[i], this->points));
     }
+
+#ifdef VEAMY_INSTRUMENTATION
+    this->DOFs.flushProfile();
+#endif
+    PROFILE_COUNTER("dof creation", "elements", polygons.size());
+    PROFILE_COUNTER("dof creation", "dofs", this->DOFs.size());
 }
 
 NormResult Veamer::computeErrorNorm(NormCalculator<Polygon> *calculator, Mesh<Polygon> &mesh) {
@@ -0,0 +1,313 @@
+#include <veamy/batch/BatchRunner.h>
+#include <veamy/config/ExecutionContextScope.h>
+#include <veamy/Veamer.h>
+#include <veamy/problems/VeamyLinearElasticityDiscretization.h>
+#include <veamy/postprocess/L2NormCalculator.h>
+#include <veamy/postprocess/H1NormCalculator.h>
+#include <feamy/Feamer.h>
+#include <feamy/problem/FeamyLinearElasticityDiscretization.h>
+#include <feamy/models/constructor/Tri3Constructor.h>
+#include <delynoi/voronoi/TriangleVoronoiGenerator.h>
+#include <delynoi/voronoi/TriangleDelaunayGenerator.h>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <thread>
+
+namespace {
+    typedef std::chrono::high_resolution_clock clock_type;
+
+    double secondsSince(clock_type::time_point start){
+        return std::chrono::duration_cast<std::chrono::microseconds>(clock_type::now() - start).count()/1e6;
+    }
+
+    /*
+     * Estimate of the peak memory used to solve a system with n degrees of freedom: the global stiffness matrix is
+     * assembled as a dense matrix, plus the sparse copy and its factorization
+     */
+    size_t estimateMemory(int n){
+        return 8*((size_t) n)*n + 256*((size_t) n);
+    }
+
+    /*
+     * Frees the neighbourhood maps of a mesh (which Mesh does not own) when the problem ends, even if it fails
+     */
+    template <typename T>
+    class MeshRelease {
+    private:
+        Mesh<T>& mesh;
+    public:
+        explicit MeshRelease(Mesh<T>& mesh) : mesh(mesh) {}
+
+        ~MeshRelease(){
+            delete mesh.getSegments();
+            delete mesh.getPointMap();
+        }
+
+        MeshRelease(const MeshRelease& other) = delete;
+        MeshRelease& operator=(const MeshRelease& other) = delete;
+    };
+}
+
+BatchRunner::BatchRunner(int threads, size_t memoryBudget) {
+    this->threads = threads>0? threads : std::max(1, (int) std::thread::hardware_concurrency());
+    this->memoryBudget = memoryBudget;
+    this->memoryInUse = 0;
+}
+
+size_t BatchRunner::reserveMemory(size_t bytes) {
+    if(memoryBudget==0){
+        return 0;
+    }
+
+    bytes = std::min(bytes, memoryBudget);
+
+    std::unique_lock<std::mutex> lock(memoryMutex);
+    memoryReleased.wait(lock, [this, bytes]{ return memoryInUse + bytes <= memoryBudget; });
+    memoryInUse += bytes;
+
+    return bytes;
+}
+
+void BatchRunner::releaseMemory(size_t bytes) {
+    if(bytes==0){
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(memoryMutex);
+        memoryInUse -= bytes;
+    }
+    memoryReleased.notify_all();
+}
+
+void BatchRunner::solveVEM(ProblemSpecification &spec, BatchResult &result) {
+    clock_type::time_point start = clock_type::now();
+
+    Mesh<Polygon> mesh = [&]() -> Mesh<Polygon> {
+        if(!spec.meshFile.empty()){
+            Mesh<Polygon> m;
+            m.createFromFile(spec.meshFile, spec.startIndex);
+            return m;
+        }
+
+        Region region(*spec.region);
+        region.generateSeedPoints(*spec.generator, spec.nX, spec.nY);
+        std::vector<Point> seeds = region.getSeedPoints();
+
+        std::lock_guard<std::mutex> lock(meshMutex);
+        TriangleVoronoiGenerator generator(seeds, region);
+        return Mesh<Polygon>(generator.getMesh());
+    }();
+    MeshRelease<Polygon> release(mesh);
+    result.meshTime = secondsSince(start);
+
+    start = clock_type::now();
+    std::unique_ptr<Material> material(spec.material->clone());
+    LinearElasticityConditions conditions(material.get());
+    spec.constraints(&conditions, mesh.getPoints());
+
+    VeamyLinearElasticityDiscretization problem(&conditions);
+    Veamer v(&problem);
+    v.initProblem(mesh);
+    result.setupTime = secondsSince(start);
+
+    result.elements = (int) mesh.getPolygons().size();
+    result.points = mesh.getPoints().size();
+    result.dofs = v.DOFs.size();
+
+    start = clock_type::now();
+    size_t reserved = reserveMemory(estimateMemory(result.dofs));
+    Eigen::VectorXd x;
+    try{
+        x = v.simulate(mesh);
+    }catch(...){
+        releaseMemory(reserved);
+        throw;
+    }
+    releaseMemory(reserved);
+    result.solveTime = secondsSince(start);
+
+    start = clock_type::now();
+    if(spec.exactDisplacement!=nullptr){
+        L2NormCalculator<Polygon> L2(spec.exactDisplacement, x, v.DOFs);
+        NormResult norm = v.computeErrorNorm(&L2, mesh);
+        result.L2 = norm.NormValue;
+        result.h = norm.MaxEdge;
+    }
+    if(spec.exactStrain!=nullptr){
+        H1NormCalculator<Polygon> H1(spec.exactStrain, x, v.DOFs);
+        NormResult norm = v.computeErrorNorm(&H1, mesh);
+        result.H1 = norm.NormValue;
+        result.h = norm.MaxEdge;
+    }
+    result.normTime = secondsSince(start);
+
+    if(!spec.displacementsFile.empty()){
+        v.writeDisplacements(spec.displacementsFile, x);
+    }
+}
+
+void BatchRunner::solveFEM(ProblemSpecification &spec, BatchResult &result) {
+    clock_type::time_point start = clock_type::now();
+
+    Mesh<Triangle> mesh = [&]() -> Mesh<Triangle> {
+        if(!spec.meshFile.empty()){
+            Mesh<Triangle> m;
+            m.createFromFile(spec.meshFile, spec.startIndex);
+            return m;
+        }
+
+        Region region(*spec.region);
+        region.generateSeedPoints(*spec.generator, spec.nX, spec.nY);
+        std::vector<Point> seeds = region.getSeedPoints();
+
+        std::lock_guard<std::mutex> lock(meshMutex);
+        TriangleDelaunayGenerator generator(seeds, region);
+        return generator.getConformingDelaunayTriangulation();
+    }();
+    MeshRelease<Triangle> release(mesh);
+    result.meshTime = secondsSince(start);
+
+    start = clock_type::now();
+    std::unique_ptr<Material> material(spec.material->clone());
+    LinearElasticityConditions conditions(material.get());
+    spec.constraints(&conditions, mesh.getPoints());
+
+    FeamyLinearElasticityDiscretization problem(&conditions);
+    Tri3Constructor constructor;
+    Feamer f(&problem);
+    f.initProblem(mesh, &constructor);
+    result.setupTime = secondsSince(start);
+
+    result.elements = (int) mesh.getPolygons().size();
+    result.points = mesh.getPoints().size();
+    result.dofs = f.DOFs.size();
+
+    start = clock_type::now();
+    size_t reserved = reserveMemory(estimateMemory(result.dofs));
+    Eigen::VectorXd x;
+    try{
+        x = f.simulate(mesh);
+    }catch(...){
+        releaseMemory(reserved);
+        throw;
+    }
+    releaseMemory(reserved);
+    result.solveTime = secondsSince(start);
+
+    start = clock_type::now();
+    if(spec.exactDisplacement!=nullptr){
+        L2NormCalculator<Triangle> L2(spec.exactDisplacement, x, f.DOFs);
+        NormResult norm = f.computeErrorNorm(&L2, mesh);
+        result.L2 = norm.NormValue;
+        result.h = norm.MaxEdge;
+    }
+    if(spec.exactStrain!=nullptr){
+        H1NormCalculator<Triangle> H1(spec.exactStrain, x, f.DOFs);
+        NormResult norm = f.computeErrorNorm(&H1, mesh);
+        result.H1 = norm.NormValue;
+        result.h = norm.MaxEdge;
+    }
+    result.normTime = secondsSince(start);
+
+    if(!spec.displacementsFile.empty()){
+        f.writeDisplacements(spec.displacementsFile, x);
+    }
+}
+
+BatchResult BatchRunner::solve(ProblemSpecification &spec) {
+    BatchResult result;
+    result.name = spec.name;
+
+    clock_type::time_point start = clock_type::now();
+    ExecutionContextScope scope(spec.context);
+    Profiler::instance()->reset();
+
+    try{
+        if(spec.material==nullptr || !spec.constraints){
+            throw std::invalid_argument("Problem specification needs a material and its constraints");
+        }
+
+        if(spec.meshFile.empty() && (spec.region==nullptr || spec.generator==nullptr)){
+            throw std::invalid_argument("Problem specification needs either a mesh file or a region and a generator");
+        }
+
+        if(spec.method==BatchMethod::VEM){
+            solveVEM(spec, result);
+        }else{
+            solveFEM(spec, result);
+        }
+
+        result.success = true;
+    }catch(std::exception& e){
+        result.error = e.what();
+    }
+
+    result.totalTime = secondsSince(start);
+    result.phases = Profiler::instance()->getPhases();
+    return result;
+}
+
+std::vector<BatchResult> BatchRunner::run(std::vector<ProblemSpecification> &problems) {
+    std::vector<BatchResult> results(problems.size());
+    std::atomic<int> next(0);
+
+    auto worker = [&]() {
+        int i;
+        while((i = next++) < (int) problems.size()){
+            results[i] = solve(problems[i]);
+        }
+    };
+
+    int n = std::min(this->threads, (int) problems.size());
+    std::vector<std::thread> pool;
+
+    for (int i = 1; i < n; ++i) {
+        pool.push_back(std::thread(worker));
+    }
+    worker();
+
+    for(std::thread& t: pool){
+        t.join();
+    }
+
+    return results;
+}
+
+void BatchRunner::printTable(std::vector<BatchResult> &results, std::ostream &out) {
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
+    out << std::left << std::setw(24) << "problem" << std::right
+        << std::setw(10) << "elements" << std::setw(10) << "points" << std::setw(10) << "dofs"
+        << std::setw(10) << "mesh[s]" << std::setw(10) << "setup[s]" << std::setw(10) << "solve[s]"
+        << std::setw(10) << "norms[s]" << std::setw(10) << "total[s]"
+        << std::setw(14) << "h" << std::setw(14) << "L2" << std::setw(14) << "H1" << '\n';
+
+    for(BatchResult& r: results){
+        out << std::left << std::setw(24) << r.name << std::right;
+
+        if(!r.success){
+            out << "  failed: " << r.error << '\n';
+            continue;
+        }
+
+        out << std::setw(10) << r.elements << std::setw(10) << r.points << std::setw(10) << r.dofs
+            << std::fixed << std::setprecision(3)
+            << std::setw(10) << r.meshTime << std::setw(10) << r.setupTime << std::setw(10) << r.solveTime
+            << std::setw(10) << r.normTime << std::setw(10) << r.totalTime
+            << std::scientific << std::setprecision(5)
+            << std::setw(14) << r.h;
+
+        if(r.L2>=0) out << std::setw(14) << r.L2; else out << std::setw(14) << "-";
+        if(r.H1>=0) out << std::setw(14) << r.H1; else out << std::setw(14) << "-";
+        out << '\n';
+
+        out.flags(flags);
+        out.precision(precision);
+    }
+
+    out.flush();
+}
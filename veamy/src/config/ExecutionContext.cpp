@@ -0,0 +1,35 @@
+#include <veamy/config/ExecutionContext.h>
+
+ExecutionContext::ExecutionContext() : delynoiConfig(*DelynoiConfig::instance()),
+                                       veamyConfig(*VeamyConfig::instance()),
+                                       feamyConfig(*FeamyConfig::instance()) {}
+
+void ExecutionContext::setTolerance(double t) {
+    this->delynoiConfig.setTolerance(t);
+    this->veamyConfig.setTolerance(t);
+}
+
+void ExecutionContext::setPrecision(int p) {
+    this->veamyConfig.setPrecision(p);
+    this->delynoiConfig.setPrecision(p);
+}
+
+void ExecutionContext::setGamma(double g) {
+    this->veamyConfig.setGamma(g);
+}
+
+void ExecutionContext::setNumberOfGaussPoints(int gauss) {
+    this->feamyConfig.setNumberOfGaussPoints(gauss);
+}
+
+DelynoiConfig *ExecutionContext::getDelynoiConfig() {
+    return &this->delynoiConfig;
+}
+
+VeamyConfig *ExecutionContext::getVeamyConfig() {
+    return &this->veamyConfig;
+}
+
+FeamyConfig *ExecutionContext::getFeamyConfig() {
+    return &this->feamyConfig;
+}
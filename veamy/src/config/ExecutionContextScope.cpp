@@ -0,0 +1,20 @@
+#include <veamy/config/ExecutionContextScope.h>
+
+ExecutionContextScope::ExecutionContextScope(ExecutionContext &context) {
+    this->previousDelynoi = DelynoiConfig::activate(context.getDelynoiConfig());
+    this->previousVeamy = VeamyConfig::activate(context.getVeamyConfig());
+    this->previousFeamy = FeamyConfig::activate(context.getFeamyConfig());
+}
+
+ExecutionContextScope::ExecutionContextScope(DelynoiConfig *delynoiConfig, VeamyConfig *veamyConfig,
+                                             FeamyConfig *feamyConfig) {
+    this->previousDelynoi = DelynoiConfig::activate(delynoiConfig);
+    this->previousVeamy = VeamyConfig::activate(veamyConfig);
+    this->previousFeamy = FeamyConfig::activate(feamyConfig);
+}
+
+ExecutionContextScope::~ExecutionContextScope() {
+    DelynoiConfig::activate(this->previousDelynoi);
+    VeamyConfig::activate(this->previousVeamy);
+    FeamyConfig::activate(this->previousFeamy);
+}
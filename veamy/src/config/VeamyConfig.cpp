@@ -2,7 +2,7 @@
 #include <delynoi/config/DelynoiConfig.h>
 
 
-VeamyConfig* VeamyConfig::s_instance = nullptr;
+thread_local VeamyConfig* VeamyConfig::active = nullptr;
 
 VeamyConfig::VeamyConfig() {
     this->double_comparison_tolerance = 0.001;
@@ -39,10 +39,15 @@ int VeamyConfig::getPrecision() {
     return this->precision;
 }
 
-VeamyConfig *VeamyConfig::instance() {
-    if(!s_instance){
-        s_instance = new VeamyConfig;
-    }
+VeamyConfig *VeamyConfig::defaultInstance() {
+    static VeamyConfig s_instance;
 
-    return s_instance;
+    return &s_instance;
+}
+
+VeamyConfig *VeamyConfig::activate(VeamyConfig *config) {
+    VeamyConfig* previous = active;
+    active = config;
+
+    return previous;
 }
@@ -1,5 +1,6 @@
 #include <feamy/Feamer.h>
 #include <feamy/postprocess/integrator/FeamyIntegrator.h>
+#include <utilities/Profiler.h>
 
 Feamer::Feamer(ProblemDiscretization<Triangle,Feamer> *problem) :
         Calculator2D(problem->getConditions(), problem->numberOfDOFs()){
@@ -7,8 +8,11 @@ Feamer::Feamer(ProblemDiscretization<Triangle,Feamer> *problem) :
 }
 
 void Feamer::initProblem(Mesh<Triangle>& m, FeamyElementConstructor *constructor) {
+    PROFILE_PHASE("dof creation");
     UniqueList<Point>& meshPoints = m.getPoints();
     this->points.push_list(meshPoints);
+    this->pointPermutation = m.getPointPermutation();
+    this->quadrature.reset();
 
     std::vector<Triangle> triangles = m.getPolygons();
 
@@ -18,6 +22,12 @@ void Feamer::initProblem(Mesh<Triangle>& m, FeamyElementConstructor *constructor
 
         this->elements.push_back(newElement);
     }
+
+#ifdef VEAMY_INSTRUMENTATION
+    this->DOFs.flushProfile();
+#endif
+    PROFILE_COUNTER("dof creation", "elements", triangles.size());
+    PROFILE_COUNTER("dof creation", "dofs", this->DOFs.size());
 }
 
 Mesh<Triangle> Feamer::initProblemFromFile(std::string fileName, FeamyElementConstructor *constructor) {
@@ -1,6 +1,6 @@
 #include <feamy/config/FeamyConfig.h>
 
-FeamyConfig* FeamyConfig::s_instance = nullptr;
+thread_local FeamyConfig* FeamyConfig::active = nullptr;
 
 FeamyConfig::FeamyConfig() {
     this->gaussPoints = 2; //order!
@@ -14,10 +14,15 @@ int FeamyConfig::getNumberOfGaussPoints() {
     return this->gaussPoints;
 }
 
-FeamyConfig *FeamyConfig::instance() {
-    if(!s_instance){
-        s_instance = new FeamyConfig;
-    }
+FeamyConfig *FeamyConfig::defaultInstance() {
+    static FeamyConfig s_instance;
 
-    return s_instance;
+    return &s_instance;
+}
+
+FeamyConfig *FeamyConfig::activate(FeamyConfig *config) {
+    FeamyConfig* previous = active;
+    active = config;
+
+    return previous;
 }
@@ -9,18 +9,15 @@ template <typename T, typename S>
 void AreaIntegrator<T,S>::integrate(S& result, int nGauss, T element, std::vector<Point>& points,
                                           IntegrableFunction<S> *integrable) {
     std::vector<VeamyTriangle> triangles = element.triangulate(points);
+    gauss_quadrature::TriangleRule rule = gauss_quadrature::triangle_rule(nGauss);
+    std::vector<double> x(rule.size), y(rule.size), weights(rule.size);
 
-    for(VeamyTriangle t: triangles){
-        std::vector<Point> p = t.getPoints(points);
+    for(VeamyTriangle& t: triangles){
+        Eigen::MatrixXd triangle = gauss_quadrature::trianglePoints(t, points);
+        gauss_quadrature::map_triangle_rule(rule, triangle, t.getArea(points), x.data(), y.data(), weights.data());
 
-        Eigen::MatrixXd gaussPoints;
-        std::vector<double> weights;
-        gauss_quadrature::triangle_rules(gaussPoints, t, weights, nGauss, points);
-
-        for (int i = 0; i < weights.size(); ++i) {
-            Point point = Point(gaussPoints(i,0), gaussPoints(i,1));
-
-            S s = integrable->apply(point, t);
+        for (int i = 0; i < rule.size; ++i) {
+            S s = integrable->apply(Point(x[i], y[i]), t);
             result += weights[i] * s;
         }
     }
@@ -1,10 +1,11 @@
 #include <feamy/integration/LineIntegrator.h>
 
 void LineIntegrator::integrate(Eigen::VectorXd& result, int nGauss, PointSegment segment, IntegrableFunction<Eigen::VectorXd> *integrable) {
-    std::vector<double> gaussPoints, weights;
-    gauss_quadrature::gauss_1d(nGauss, gaussPoints, weights);
+    gauss_quadrature::LineRule rule = gauss_quadrature::line_rule(nGauss);
+    const double* gaussPoints = rule.points;
+    const double* weights = rule.weights;
 
-    for (int i = 0; i < gaussPoints.size(); ++i) {
+    for (int i = 0; i < rule.size; ++i) {
         double x = (segment.getFirst().getX() + segment.getSecond().getX())/2 +
                 (segment.getSecond().getX() - segment.getFirst().getX())/2*gaussPoints[i];
         double y = (segment.getFirst().getY() + segment.getSecond().getY())/2 +
@@ -1,177 +1,165 @@
-#include <vector>
-#include <delynoi/models/basic/Point.h>
+#include <feamy/integration/quadrature/gauss_quadrature.h>
+
+namespace {
+    /*
+     * Gauss-Legendre points (in [-1,1]) and weights of orders 1 to 10
+     */
+    constexpr double line1Points[] = {
+            0.0};
+    constexpr double line1Weights[] = {
+            2.0};
+    constexpr double line2Points[] = {
+            -0.577350269189625764509148780502, 0.577350269189625764509148780502};
+    constexpr double line2Weights[] = {
+            1.0, 1.0};
+    constexpr double line3Points[] = {
+            -0.774596669241483377035853079956, 0.000000000000000, 0.774596669241483377035853079956};
+    constexpr double line3Weights[] = {
+            0.5555555555555555555555555555565, 0.8888888888888888888888888888889, 0.5555555555555555555555555555565};
+    constexpr double line4Points[] = {
+            -0.861136311594052575223946488893, -0.339981043584856264802665759103, 0.339981043584856264802665759103,
+            0.861136311594052575223946488893};
+    constexpr double line4Weights[] = {
+            0.347854845137453857373063949222, 0.652145154862546142626936050778, 0.652145154862546142626936050778,
+            0.347854845137453857373063949222};
+    constexpr double line5Points[] = {
+            -0.906179845938663992797626878299, -0.538469310105683091036314420700, 0.0,
+            0.538469310105683091036314420700, 0.906179845938663992797626878299};
+    constexpr double line5Weights[] = {
+            0.236926885056189087514264040720, 0.478628670499366468041291514836, 0.568888888888888888888888888889,
+            0.478628670499366468041291514836, 0.236926885056189087514264040720};
+    constexpr double line6Points[] = {
+            -0.932469514203152027812301554494, -0.661209386466264513661399595020, -0.238619186083196908630501721681,
+            0.238619186083196908630501721681, 0.661209386466264513661399595020, 0.932469514203152027812301554494};
+    constexpr double line6Weights[] = {
+            0.171324492379170345040296142173, 0.360761573048138607569833513838, 0.467913934572691047389870343990,
+            0.467913934572691047389870343990, 0.360761573048138607569833513838, 0.171324492379170345040296142173};
+    constexpr double line7Points[] = {
+            -0.949107912342758524526189684048, -0.741531185599394439863864773281, -0.405845151377397166906606412077,
+            0.0, 0.405845151377397166906606412077, 0.741531185599394439863864773281,
+            0.949107912342758524526189684048};
+    constexpr double line7Weights[] = {
+            0.129484966168869693270611432679, 0.279705391489276667901467771424, 0.381830050505118944950369775489,
+            0.417959183673469387755102040816, 0.381830050505118944950369775489, 0.279705391489276667901467771424,
+            0.129484966168869693270611432679};
+    constexpr double line8Points[] = {
+            -0.960289856497536231683560868569, -0.796666477413626739591553936476, -0.525532409916328985817739049189,
+            -0.183434642495649804939476142360, 0.183434642495649804939476142360, 0.525532409916328985817739049189,
+            0.796666477413626739591553936476, 0.960289856497536231683560868569};
+    constexpr double line8Weights[] = {
+            0.101228536290376259152531354310, 0.222381034453374470544355994426, 0.313706645877887287337962201987,
+            0.362683783378361982965150449277, 0.362683783378361982965150449277, 0.313706645877887287337962201987,
+            0.222381034453374470544355994426, 0.101228536290376259152531354310};
+    constexpr double line9Points[] = {
+            -0.968160239507626089835576202904, -0.836031107326635794299429788070, -0.613371432700590397308702039341,
+            -0.324253423403808929038538014643, 0.0, 0.324253423403808929038538014643,
+            0.613371432700590397308702039341, 0.836031107326635794299429788070, 0.968160239507626089835576202904};
+    constexpr double line9Weights[] = {
+            0.0812743883615744119718921581105, 0.180648160694857404058472031243, 0.260610696402935462318742869419,
+            0.312347077040002840068630406584, 0.330239355001259763164525069287, 0.312347077040002840068630406584,
+            0.260610696402935462318742869419, 0.180648160694857404058472031243, 0.0812743883615744119718921581105};
+    constexpr double line10Points[] = {
+            -0.973906528517171720077964012084, -0.865063366688984510732096688423, -0.679409568299024406234327365115,
+            -0.433395394129247290799265943166, -0.148874338981631210884826001130, 0.148874338981631210884826001130,
+            0.433395394129247290799265943166, 0.679409568299024406234327365115, 0.865063366688984510732096688423,
+            0.973906528517171720077964012084};
+    constexpr double line10Weights[] = {
+            0.0666713443086881375935688098933, 0.149451349150580593145776339658, 0.219086362515982043995534934228,
+            0.269266719309996355091226921569, 0.295524224714752870173892994651, 0.295524224714752870173892994651,
+            0.269266719309996355091226921569, 0.219086362515982043995534934228, 0.149451349150580593145776339658,
+            0.0666713443086881375935688098933};
+
+    constexpr gauss_quadrature::LineRule lineRules[] = {
+            {1, line1Points, line1Weights},
+            {2, line2Points, line2Weights},
+            {3, line3Points, line3Weights},
+            {4, line4Points, line4Weights},
+            {5, line5Points, line5Weights},
+            {6, line6Points, line6Weights},
+            {7, line7Points, line7Weights},
+            {8, line8Points, line8Weights},
+            {9, line9Points, line9Weights},
+            {10, line10Points, line10Weights}};
+
+    /*
+     * Symmetric triangle rules of orders 1 to 5: barycentric coordinates of the points, and weights as fractions of the
+     * area of the triangle
+     */
+    constexpr double triangle1Points[][3] = {
+            {1.0 / 3.0, 1.0 / 3.0, 1.0 / 3.0}};
+    constexpr double triangle1Weights[] = {
+            1.0};
+    constexpr double triangle2Points[][3] = {
+            {2.0 / 3.0, 1.0 / 6.0, 1.0 / 6.0},
+            {1.0 / 6.0, 2.0 / 3.0, 1.0 / 6.0},
+            {1.0 / 6.0, 1.0 / 6.0, 2.0 / 3.0}};
+    constexpr double triangle2Weights[] = {
+            1.0 / 3.0, 1.0 / 3.0, 1.0 / 3.0};
+    constexpr double triangle3Points[][3] = {
+            {0.659027622374092, 0.231933368553031, 0.109039009072877},
+            {0.109039009072877, 0.659027622374092, 0.231933368553031},
+            {0.231933368553031, 0.109039009072877, 0.659027622374092},
+            {0.109039009072877, 0.231933368553031, 0.659027622374092},
+            {0.231933368553031, 0.659027622374092, 0.109039009072877},
+            {0.659027622374092, 0.109039009072877, 0.231933368553031}};
+    constexpr double triangle3Weights[] = {
+            1.0 / 6.0, 1.0 / 6.0, 1.0 / 6.0,
+            1.0 / 6.0, 1.0 / 6.0, 1.0 / 6.0};
+    constexpr double triangle4Points[][3] = {
+            {0.816847572980459, 0.091576213509771, 0.091576213509771},
+            {0.091576213509771, 0.816847572980459, 0.091576213509771},
+            {0.091576213509771, 0.091576213509771, 0.816847572980459},
+            {0.108103018168070, 0.445948490915965, 0.445948490915965},
+            {0.445948490915965, 0.108103018168070, 0.445948490915965},
+            {0.445948490915965, 0.445948490915965, 0.108103018168070}};
+    constexpr double triangle4Weights[] = {
+            0.109951743655322, 0.109951743655322, 0.109951743655322,
+            0.223381589678011, 0.223381589678011, 0.223381589678011};
+    constexpr double triangle5Points[][3] = {
+            {1.0 / 3.0, 1.0 / 3.0, 1.0 / 3.0},
+            {0.059715871789770, 0.470142064105115, 0.470142064105115},
+            {0.470142064105115, 0.059715871789770, 0.470142064105115},
+            {0.470142064105115, 0.470142064105115, 0.059715871789770},
+            {0.797426985353087, 0.101286507323456, 0.101286507323456},
+            {0.101286507323456, 0.797426985353087, 0.101286507323456},
+            {0.101286507323456, 0.101286507323456, 0.797426985353087}};
+    constexpr double triangle5Weights[] = {
+            0.225000000000000, 0.132394152788506, 0.132394152788506,
+            0.132394152788506, 0.125939180544827, 0.125939180544827,
+            0.125939180544827};
+
+    constexpr gauss_quadrature::TriangleRule triangleRules[] = {
+            {1, triangle1Points, triangle1Weights},
+            {3, triangle2Points, triangle2Weights},
+            {6, triangle3Points, triangle3Weights},
+            {6, triangle4Points, triangle4Weights},
+            {7, triangle5Points, triangle5Weights}};
+}
 
 namespace gauss_quadrature{
-    void gauss_1d(int order, std::vector<double>& points, std::vector<double>& weights){
-        if(order == 1){
-            points.push_back(0.0);
-
-            weights.push_back(2.0);
-            return;
+    LineRule line_rule(int order){
+        if(order<1 || order>10){
+            return LineRule{0, nullptr, nullptr};
         }
 
-        if(order == 2){
-            points.push_back(-0.577350269189625764509148780502);
-            points.push_back(0.577350269189625764509148780502);
-
-            weights.push_back(1.0);
-            weights.push_back(1.0);
-
-            return;
-        }
-
-        if(order == 3){
-            points.push_back(-0.774596669241483377035853079956);
-            points.push_back(0.000000000000000);
-            points.push_back(0.774596669241483377035853079956);
-
-            weights.push_back(0.5555555555555555555555555555565);
-            weights.push_back(0.8888888888888888888888888888889);
-            weights.push_back(0.5555555555555555555555555555565);
-
-            return;
-        }
-
-        if(order == 4){
-            points.push_back(-0.861136311594052575223946488893);
-            points.push_back(-0.339981043584856264802665759103);
-            points.push_back(0.339981043584856264802665759103);
-            points.push_back(0.861136311594052575223946488893);
-
-            weights.push_back(0.347854845137453857373063949222);
-            weights.push_back(0.652145154862546142626936050778);
-            weights.push_back(0.652145154862546142626936050778);
-            weights.push_back(0.347854845137453857373063949222);
-
-            return;
-        }
-
-        if(order == 5){
-            points.push_back(-0.906179845938663992797626878299);
-            points.push_back(-0.538469310105683091036314420700);
-            points.push_back(0.0);
-            points.push_back(0.538469310105683091036314420700);
-            points.push_back(0.906179845938663992797626878299);
-
-            weights.push_back(0.236926885056189087514264040720);
-            weights.push_back(0.478628670499366468041291514836);
-            weights.push_back(0.568888888888888888888888888889);
-            weights.push_back(0.478628670499366468041291514836);
-            weights.push_back(0.236926885056189087514264040720);
-
-            return;
-        }
-
-        if(order == 6){
-            points.push_back(-0.932469514203152027812301554494);
-            points.push_back(-0.661209386466264513661399595020);
-            points.push_back(-0.238619186083196908630501721681);
-            points.push_back(0.238619186083196908630501721681);
-            points.push_back(0.661209386466264513661399595020);
-            points.push_back(0.932469514203152027812301554494);
-
-            weights.push_back(0.171324492379170345040296142173);
-            weights.push_back(0.360761573048138607569833513838);
-            weights.push_back(0.467913934572691047389870343990);
-            weights.push_back(0.467913934572691047389870343990);
-            weights.push_back(0.360761573048138607569833513838);
-            weights.push_back(0.171324492379170345040296142173);
-
-            return;
-        }
-
-        if(order == 7){
-            points.push_back(-0.949107912342758524526189684048);
-            points.push_back(-0.741531185599394439863864773281);
-            points.push_back(-0.405845151377397166906606412077);
-            points.push_back(0.0);
-            points.push_back(0.405845151377397166906606412077);
-            points.push_back(0.741531185599394439863864773281);
-            points.push_back( 0.949107912342758524526189684048);
-
-            weights.push_back(0.129484966168869693270611432679);
-            weights.push_back(0.279705391489276667901467771424);
-            weights.push_back(0.381830050505118944950369775489);
-            weights.push_back(0.417959183673469387755102040816);
-            weights.push_back(0.381830050505118944950369775489);
-            weights.push_back(0.279705391489276667901467771424);
-            weights.push_back(0.129484966168869693270611432679);
-
-            return;
-        }
-
-        if(order == 8){
-            points.push_back(-0.960289856497536231683560868569);
-            points.push_back(-0.796666477413626739591553936476);
-            points.push_back(-0.525532409916328985817739049189);
-            points.push_back(-0.183434642495649804939476142360);
-            points.push_back(0.183434642495649804939476142360);
-            points.push_back(0.525532409916328985817739049189);
-            points.push_back(0.796666477413626739591553936476);
-            points.push_back(0.960289856497536231683560868569);
-
-            weights.push_back(0.101228536290376259152531354310);
-            weights.push_back(0.222381034453374470544355994426);
-            weights.push_back(0.313706645877887287337962201987);
-            weights.push_back(0.362683783378361982965150449277);
-            weights.push_back(0.362683783378361982965150449277);
-            weights.push_back(0.313706645877887287337962201987);
-            weights.push_back(0.222381034453374470544355994426);
-            weights.push_back(0.101228536290376259152531354310);
+        return lineRules[order - 1];
+    }
 
-            return;
+    TriangleRule triangle_rule(int order){
+        if(order<1 || order>5){
+            return TriangleRule{0, nullptr, nullptr};
         }
 
-        if(order == 9){
-            points.push_back(-0.968160239507626089835576202904);
-            points.push_back(-0.836031107326635794299429788070);
-            points.push_back(-0.613371432700590397308702039341);
-            points.push_back(-0.324253423403808929038538014643);
-            points.push_back(0.0);
-            points.push_back(0.324253423403808929038538014643);
-            points.push_back(0.613371432700590397308702039341);
-            points.push_back(0.836031107326635794299429788070);
-            points.push_back(0.968160239507626089835576202904);
-
-            weights.push_back(0.0812743883615744119718921581105);
-            weights.push_back(0.180648160694857404058472031243);
-            weights.push_back(0.260610696402935462318742869419);
-            weights.push_back(0.312347077040002840068630406584);
-            weights.push_back(0.330239355001259763164525069287);
-            weights.push_back(0.312347077040002840068630406584);
-            weights.push_back(0.260610696402935462318742869419);
-            weights.push_back(0.180648160694857404058472031243);
-            weights.push_back(0.0812743883615744119718921581105);
-
-            return;
-        }
+        return triangleRules[order - 1];
+    }
 
-        if(order == 10){
-            points.push_back(-0.973906528517171720077964012084);
-            points.push_back(-0.865063366688984510732096688423);
-            points.push_back(-0.679409568299024406234327365115);
-            points.push_back(-0.433395394129247290799265943166);
-            points.push_back(-0.148874338981631210884826001130);
-            points.push_back(0.148874338981631210884826001130);
-            points.push_back(0.433395394129247290799265943166);
-            points.push_back(0.679409568299024406234327365115);
-            points.push_back(0.865063366688984510732096688423);
-            points.push_back(0.973906528517171720077964012084);
-
-            weights.push_back(0.0666713443086881375935688098933);
-            weights.push_back(0.149451349150580593145776339658);
-            weights.push_back(0.219086362515982043995534934228);
-            weights.push_back(0.269266719309996355091226921569);
-            weights.push_back(0.295524224714752870173892994651);
-            weights.push_back(0.295524224714752870173892994651);
-            weights.push_back(0.269266719309996355091226921569);
-            weights.push_back(0.219086362515982043995534934228);
-            weights.push_back(0.149451349150580593145776339658);
-            weights.push_back(0.0666713443086881375935688098933);
+    void gauss_1d(int order, std::vector<double>& points, std::vector<double>& weights){
+        LineRule rule = line_rule(order);
 
-            return;
-        }
+        points.insert(points.end(), rule.points, rule.points + rule.size);
+        weights.insert(weights.end(), rule.weights, rule.weights + rule.size);
     }
+
     // These quadratures for triangles are not being used. 
     // Instead we use those defined in include/veamy/postprocess/utilities/norm_utilities.h
     void gauss_triangle(int order, std::vector<Point>& points, std::vector<double>& weights){
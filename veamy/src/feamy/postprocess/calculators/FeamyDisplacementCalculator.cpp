@@ -32,5 +32,33 @@ void FeamyDisplacementCalculator<T>::setPolygonIndex(int polyIndex) {
     this->polygonIndex = polyIndex;
 }
 
+template <typename T>
+void FeamyDisplacementCalculator<T>::getDisplacements(const double *x, const double *y, int n, T &container,
+                                                      int containerIndex, std::vector<double> &values) {
+    int n_dofs = this->dofs.getNumberOfDOFS();
+    ShapeFunctions* shapeFunctions = this->elements[containerIndex]->getShapeFunctions();
+
+    std::vector<int> containerPoints = container.getPoints();
+    std::vector<double> nodalValues;
+    for (int i = 0; i < containerPoints.size(); ++i) {
+        std::vector<int> pointDOFS = this->dofs.pointToDOFS(containerPoints[i]);
+
+        for (int j = 0; j < n_dofs; ++j) {
+            nodalValues.push_back(this->nodalValues[pointDOFS[j]]);
+        }
+    }
+
+    values.assign(n*n_dofs, 0);
+    for (int k = 0; k < n; ++k) {
+        std::vector<double> N = shapeFunctions->evaluateShapeFunctionCartesian(Point(x[k],y[k]));
+
+        for (int i = 0; i < containerPoints.size(); ++i) {
+            for (int j = 0; j < n_dofs; ++j) {
+                values[k*n_dofs + j] += nodalValues[i*n_dofs + j]*N[i];
+            }
+        }
+    }
+}
+
 template class FeamyDisplacementCalculator<Triangle>;
 template class FeamyDisplacementCalculator<Polygon>;
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include <feamy/postprocess/calculators/FeamyStrainCalculator.h>
 #include <feamy/problem/linear_elasticity/LinearElasticityStiffnessMatrixIntegrable.h>
 #include <veamy/postprocess/utilities/norm_utilities.h>
+#include <delynoi/utilities/parallel.h>
 
 template <typename T>
 FeamyStrainCalculator<T>::FeamyStrainCalculator(std::vector<Point> &points, std::vector<FeamyElement *>& elements,
@@ -21,5 +22,67 @@ Eigen::VectorXd FeamyStrainCalculator<T>::getStrain(double x, double y, T contai
     return strain;
 }
 
+template <typename T>
+void FeamyStrainCalculator<T>::prepare(std::vector<T> &elements) {
+    this->inverseJacobians.clear();
+    this->nodalValues.clear();
+    this->setPreparedElements(elements);
+    this->inverseJacobians.resize(4*elements.size());
+    this->nodalValues.resize(elements.size());
+
+    delynoi_utilities::parallelFor((int) elements.size(), delynoi_utilities::numberOfThreads(),
+                                   [&](int begin, int end){
+        for (int i = begin; i < end; ++i) {
+            T container = elements[i];
+            Eigen::MatrixXd invJ = VeamyTriangle(container).getJacobian(this->points).inverse();
+
+            double* inverse = this->inverseJacobians.data() + 4*i;
+            inverse[0] = invJ(0,0); inverse[1] = invJ(0,1);
+            inverse[2] = invJ(1,0); inverse[3] = invJ(1,1);
+            this->nodalValues[i] = norm_utilities::getElementNodalValues(container, this->u, this->d);
+        }
+    });
+}
+
+template <typename T>
+void FeamyStrainCalculator<T>::getStrains(const double *x, const double *y, int n, T &container, int containerIndex,
+                                          std::vector<double> &values) {
+    ShapeFunctions* shapeFunctions = this->elements[containerIndex]->getShapeFunctions();
+
+    if(!this->isPrepared(container, containerIndex)){
+        Eigen::VectorXd uH = norm_utilities::getElementNodalValues(container, this->u, this->d);
+        Eigen::MatrixXd jacobian = VeamyTriangle(container).getJacobian(this->points);
+        LinearElasticityStiffnessMatrixIntegrable integrable;
+
+        values.clear();
+        for (int i = 0; i < n; ++i) {
+            Eigen::VectorXd strain = integrable.BeMatrix(Point(x[i],y[i]), jacobian, shapeFunctions)*uH;
+            values.insert(values.end(), strain.data(), strain.data() + strain.size());
+        }
+
+        return;
+    }
+
+    // Be*uH, without building Be: each shape function contributes its cartesian derivatives (dx, dy) as
+    // (dx*u, dy*v, dy*u + dx*v)
+    const double* invJ = this->inverseJacobians.data() + 4*containerIndex;
+    const Eigen::VectorXd& uH = this->nodalValues[containerIndex];
+
+    values.assign(3*n, 0);
+    for (int i = 0; i < n; ++i) {
+        std::vector<Pair<double>> dN = shapeFunctions->evaluateDerivatives(Point(x[i],y[i]));
+        double* strain = values.data() + 3*i;
+
+        for (int v = 0; v < dN.size(); ++v) {
+            double dx = dN[v].first*invJ[0] + dN[v].second*invJ[1];
+            double dy = dN[v].first*invJ[2] + dN[v].second*invJ[3];
+
+            strain[0] += dx*uH(2*v);
+            strain[1] += dy*uH(2*v + 1);
+            strain[2] += dy*uH(2*v) + dx*uH(2*v + 1);
+        }
+    }
+}
+
 template class FeamyStrainCalculator<Polygon>;
 template class FeamyStrainCalculator<Triangle>;
\ No newline at end of file
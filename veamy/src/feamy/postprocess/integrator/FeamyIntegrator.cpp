@@ -15,18 +15,42 @@ FeamyIntegrator<T>::FeamyIntegrator(Computable<T>* computable) {
 template <typename T>
 double FeamyIntegrator<T>::getIntegral(T poly, int polyIndex, std::vector<Point>& points) {
     this->computable->setPolygonIndex(polyIndex);
-    IntegrableFunctionComputable<T>* computable = new IntegrableFunctionComputable<T>(this->computable);
-    double result;
-
+    double result = 0;
+
+    if(this->quadrature!=nullptr){
+        const double* x = this->quadrature->getX();
+        const double* y = this->quadrature->getY();
+        const double* w = this->quadrature->getWeights();
+        const std::vector<Triangle>& triangles = this->quadrature->getTriangles();
+        int n = this->quadrature->pointsPerTriangle();
+
+        // As in AreaIntegrator, each point is evaluated with its sub-triangle as container
+        this->values.resize(n);
+        for (int t = this->quadrature->firstTriangle(polyIndex); t < this->quadrature->endTriangle(polyIndex); ++t) {
+            T container = triangles[t];
+            this->computable->applyBatch(x + t*n, y + t*n, n, container, this->values.data());
+
+            for (int i = 0; i < n; ++i) {
+                result += w[t*n + i]*this->values[i];
+            }
+        }
+
+        return result;
+    }
+
+    IntegrableFunctionComputable<T> computable(this->computable);
     FeamyConfig* config = FeamyConfig::instance();
-    AreaIntegrator<VeamyPolygon,double>::integrate(result, config->getNumberOfGaussPoints(), VeamyPolygon(poly), points, computable);
+    AreaIntegrator<VeamyPolygon,double>::integrate(result, config->getNumberOfGaussPoints(), VeamyPolygon(poly), points, &computable);
 
     return result;
 }
 
 template <typename T>
 NormIntegrator<T> *FeamyIntegrator<T>::clone() {
-    return new FeamyIntegrator<T>;
+    FeamyIntegrator<T>* integrator = new FeamyIntegrator<T>;
+    integrator->setQuadrature(this->quadrature);
+
+    return integrator;
 }
 
 template <typename T>
@@ -81,6 +81,9 @@ Mesh<Triangle> FeamyLinearElasticityDiscretization::initProblemFromFile(std::str
 
     infile.close();
 
+    // Reordered once the constraints, which refer to the points by their index in the file, have been read
+    mesh.reorder(DelynoiConfig::instance()->getMeshOrdering());
+
     return mesh;
 }
 
@@ -88,7 +91,10 @@ NormResult
 FeamyLinearElasticityDiscretization::computeErrorNorm(NormCalculator<Triangle> *calculator, Mesh<Triangle>& mesh, Feamer* f) {
     FeamyAdditionalInfo info(f->getElements(), mesh.getPoints().getList());
 
-    calculator->setCalculator(new FeamyIntegrator<Triangle>, info);
+    FeamyIntegrator<Triangle>* integrator = new FeamyIntegrator<Triangle>;
+    integrator->setQuadrature(f->getQuadrature(mesh, ElementTriangulation::Ears));
+
+    calculator->setCalculator(integrator, info);
     calculator->setExtraInformation(this->conditions);
 
     return calculator->getNorm(mesh);
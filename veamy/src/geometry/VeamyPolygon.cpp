@@ -1,14 +1,14 @@
 #include <veamy/geometry/VeamyPolygon.h>
-#include <delynoi/triangulation/EarTriangulationGenerator.h>
+#include <delynoi/triangulation/EarClipper.h>
 
 VeamyPolygon::VeamyPolygon(Polygon p) : Polygon(p){}
 
 std::vector<VeamyTriangle> VeamyPolygon::triangulate(std::vector<Point> &points) {
     std::vector<VeamyTriangle> veamyTriangles;
-    std::vector<Triangle> triangles = EarTriangulationGenerator().triangulate(*this, points);
+    std::vector<Trio<int>> triangles = EarClipper().triangulate(this->points, points);
 
-    for(Triangle t: triangles){
-        veamyTriangles.push_back(VeamyTriangle(t));
+    for(Trio<int>& t: triangles){
+        veamyTriangles.push_back(VeamyTriangle(Triangle({t.first, t.second, t.third}, points)));
     }
 
     return veamyTriangles;
@@ -1,6 +1,15 @@
 #include <veamy/models/dof/DOFS.h>
+#include <utilities/Profiler.h>
 
+#ifdef VEAMY_INSTRUMENTATION
+DOFS::DOFS() : matchingTimer("constraint matching") {}
+
+void DOFS::flushProfile() {
+    matchingTimer.flush();
+}
+#else
 DOFS::DOFS() {}
+#endif
 
 std::vector<int>
 DOFS::addDOF(ConstraintsContainer &constraints, std::vector<Point> &points, int point_index, SegmentPair pair) {
@@ -23,7 +32,9 @@ DOFS::addDOF(ConstraintsContainer &constraints, std::vector<Point> &points, int
         DOF newDOF = DOF(list.size(),point_index, j);
 
         int newIndex = list.push_back(newDOF);
+        PROFILE_RESUME(matchingTimer);
         constraints.addConstrainedDOF(points, newIndex, j, pair, point_index);
+        PROFILE_PAUSE(matchingTimer);
 
         DOF_indexes.push_back(newIndex);
 
@@ -17,13 +17,17 @@ Eigen::VectorXd VeamyBodyForceVector::computeForceVector(BodyForce *f) {
     Eigen::VectorXd result;
     result = Eigen::VectorXd::Zero(n*dofs);
 
+    std::vector<double> x(n), y(n), values(n);
     for (int i = 0; i < n; ++i) {
-        Point point = points[polygonPoints[i]];
+        x[i] = points[polygonPoints[i]].getX();
+        y[i] = points[polygonPoints[i]].getY();
+    }
 
-         for (int j = 0; j < dofs; ++j){
-            double res = components[j]->apply(point.getX(), point.getY(), polygonPoints[i], this->polygon);
+    for (int j = 0; j < dofs; ++j){
+        components[j]->applyBatch(x.data(), y.data(), n, this->polygon, values.data());
 
-            result(i*dofs + j) = area*res/n;
+        for (int i = 0; i < n; ++i) {
+            result(i*dofs + j) = area*values[i]/n;
         }
     }
 
@@ -1,6 +1,7 @@
 #include <veamy/physics/materials/Material.h>
 #include <veamy/config/VeamyConfig.h>
 #include <iostream>
+#include <stdexcept>
 
 Material::Material(double E, double v) {
     this->material_v = v;
@@ -9,6 +10,10 @@ Material::Material(double E, double v) {
 
 Material::Material() {}
 
+Material* Material::clone() {
+    throw std::invalid_argument("This material can not be copied, as it does not override Material::clone");
+}
+
 Material::Material(Materials::material m) {
     material_info info = Materials::properties[m];
 
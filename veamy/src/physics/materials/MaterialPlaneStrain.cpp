@@ -4,6 +4,10 @@ MaterialPlaneStrain::MaterialPlaneStrain(Materials::material m) : Material(m) {}
 
 MaterialPlaneStrain::MaterialPlaneStrain(double young, double poisson) : Material(young, poisson) {}
 
+Material *MaterialPlaneStrain::clone() {
+    return new MaterialPlaneStrain(*this);
+}
+
 Eigen::MatrixXd MaterialPlaneStrain::getMaterialMatrix() {
     Eigen::MatrixXd D;
     D = Eigen::MatrixXd::Zero(3,3);
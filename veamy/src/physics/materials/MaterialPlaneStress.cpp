@@ -5,6 +5,10 @@ MaterialPlaneStress::MaterialPlaneStress(Materials::material m) : Material(m) {}
 
 MaterialPlaneStress::MaterialPlaneStress(double young, double poisson) : Material(young, poisson) {}
 
+Material *MaterialPlaneStress::clone() {
+    return new MaterialPlaneStress(*this);
+}
+
 Eigen::MatrixXd MaterialPlaneStress::getMaterialMatrix() {
     Eigen::MatrixXd D;
     D = Eigen::MatrixXd::Zero(3,3);
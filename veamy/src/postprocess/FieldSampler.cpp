@@ -0,0 +1,200 @@
+#include <veamy/postprocess/FieldSampler.h>
+#include <veamy/config/ExecutionContextScope.h>
+#include <delynoi/utilities/parallel.h>
+#include <utilities/Profiler.h>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+template <typename T>
+FieldSampler<T>::FieldSampler(Mesh<T> &mesh, DisplacementCalculator<T> *displacements, StrainCalculator<T> *strains,
+                              Eigen::MatrixXd D) {
+    if(displacements==nullptr){
+        throw std::invalid_argument("A displacement calculator is required to sample the solution");
+    }
+
+    this->mesh = &mesh;
+    this->displacementCalculator = displacements;
+    this->strainCalculator = strains;
+    this->D = D;
+}
+
+template <typename T>
+void FieldSampler<T>::evaluate(SampledField field, const double *x, const double *y, int n, int element,
+                               std::vector<double> &values) {
+    T container = this->mesh->getPolygon(element);
+
+    if(field==SampledField::Displacement){
+        this->displacementCalculator->getDisplacements(x, y, n, container, element, values);
+        return;
+    }
+
+    this->strainCalculator->getStrains(x, y, n, container, element, values);
+    if(field==SampledField::Strain){
+        return;
+    }
+
+    int components = (int) this->D.rows();
+    std::vector<double> stress(n*components);
+    for (int k = 0; k < n; ++k) {
+        const double* strain = values.data() + k*this->D.cols();
+
+        for (int i = 0; i < components; ++i) {
+            double s = 0;
+            for (int j = 0; j < this->D.cols(); ++j) {
+                s += this->D(i,j)*strain[j];
+            }
+
+            stress[k*components + i] = s;
+        }
+    }
+    values.swap(stress);
+}
+
+template <typename T>
+int FieldSampler<T>::sample(SampledField field, const std::vector<Point> &points, std::vector<double> &values,
+                            std::vector<char> &defined) {
+    PROFILE_PHASE("field sampling");
+    if(field!=SampledField::Displacement && this->strainCalculator==nullptr){
+        throw std::invalid_argument("A strain calculator is required to sample the strain or the stress");
+    }
+    if(field==SampledField::Stress && this->D.size()==0){
+        throw std::invalid_argument("The material matrix is required to sample the stress");
+    }
+
+    std::vector<T>& elements = this->mesh->getPolygons();
+    this->displacementCalculator->prepare(elements);
+    if(this->strainCalculator!=nullptr){
+        this->strainCalculator->prepare(elements);
+    }
+
+    int n = (int) points.size();
+    int m = (int) elements.size();
+    std::vector<int> located;
+    this->mesh->getLocator().locate(points, located);
+
+    // Points sorted by element (keeping their order inside each element), so each element is evaluated once
+    std::vector<int> offsets(m + 1, 0);
+    for(int e: located){
+        if(e>=0){
+            offsets[e + 1]++;
+        }
+    }
+    for (int e = 0; e < m; ++e) {
+        offsets[e + 1] += offsets[e];
+    }
+
+    std::vector<int> order(offsets[m]);
+    std::vector<int> next(offsets.begin(), offsets.end() - 1);
+    for (int i = 0; i < n; ++i) {
+        if(located[i]>=0){
+            order[next[located[i]]++] = i;
+        }
+    }
+
+    std::vector<int> sampled;
+    for (int e = 0; e < m; ++e) {
+        if(offsets[e + 1]>offsets[e]){
+            sampled.push_back(e);
+        }
+    }
+
+    defined.assign(n, false);
+    if(sampled.empty()){
+        values.clear();
+        return 0;
+    }
+
+    // The number of values per point depends on the problem, so it is taken from the first point
+    std::vector<double> first;
+    const Point& p = points[order[0]];
+    double px = p.getX(), py = p.getY();
+    evaluate(field, &px, &py, 1, sampled[0], first);
+    int components = (int) first.size();
+
+    values.assign((size_t) n*components, std::numeric_limits<double>::quiet_NaN());
+    DelynoiConfig* delynoiConfig = DelynoiConfig::instance();
+    VeamyConfig* veamyConfig = VeamyConfig::instance();
+    FeamyConfig* feamyConfig = FeamyConfig::instance();
+
+    delynoi_utilities::parallelFor((int) sampled.size(), delynoi_utilities::numberOfThreads(), [&](int begin, int end){
+        ExecutionContextScope scope(delynoiConfig, veamyConfig, feamyConfig);
+        std::vector<double> x, y, elementValues;
+
+        for (int k = begin; k < end; ++k) {
+            int e = sampled[k];
+            int count = offsets[e + 1] - offsets[e];
+
+            x.resize(count);
+            y.resize(count);
+            for (int j = 0; j < count; ++j) {
+                const Point& q = points[order[offsets[e] + j]];
+                x[j] = q.getX();
+                y[j] = q.getY();
+            }
+
+            evaluate(field, x.data(), y.data(), count, e, elementValues);
+
+            for (int j = 0; j < count; ++j) {
+                int i = order[offsets[e] + j];
+                std::copy(elementValues.begin() + j*components, elementValues.begin() + (j + 1)*components,
+                          values.begin() + (size_t) i*components);
+                defined[i] = true;
+            }
+        }
+
+    });
+
+    return components;
+}
+
+template <typename T>
+void FieldSampler<T>::sample(SampledField field, const std::vector<Point> &points, ResultWriter &writer) {
+    std::vector<double> values;
+    std::vector<char> defined;
+    int components = sample(field, points, values, defined);
+    int dofs = writer.getNumberOfDOFS();
+    int n = (int) points.size();
+
+    if(components!=0 && components!=dofs){
+        throw std::invalid_argument("The result writer does not have as many values per point as the sampled field");
+    }
+
+    for (int first = 0; first < n; first += ResultWriter::BLOCK_SIZE) {
+        int blockSize = std::min(ResultWriter::BLOCK_SIZE, n - first);
+
+        NodeBlock block;
+        block.first = first;
+        block.defined.assign(defined.begin() + first, defined.begin() + first + blockSize);
+        if(components==0){
+            block.values.assign(blockSize*dofs, std::numeric_limits<double>::quiet_NaN());
+        } else {
+            block.values.assign(values.begin() + (size_t) first*dofs, values.begin() + (size_t) (first + blockSize)*dofs);
+        }
+
+        writer.write(block);
+    }
+}
+
+template <typename T>
+std::vector<Point> FieldSampler<T>::grid(double xMin, double yMin, double xMax, double yMax, int nX, int nY) {
+    if(nX<1 || nY<1){
+        throw std::invalid_argument("A grid needs at least one point in each axis");
+    }
+
+    std::vector<Point> points;
+    points.reserve((size_t) nX*nY);
+
+    double dX = nX>1? (xMax - xMin)/(nX - 1) : 0;
+    double dY = nY>1? (yMax - yMin)/(nY - 1) : 0;
+    for (int j = 0; j < nY; ++j) {
+        for (int i = 0; i < nX; ++i) {
+            points.push_back(Point(xMin + i*dX, yMin + j*dY));
+        }
+    }
+
+    return points;
+}
+
+template class FieldSampler<Polygon>;
+template class FieldSampler<Triangle>;
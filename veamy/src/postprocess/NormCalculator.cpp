@@ -1,5 +1,9 @@
 #include <veamy/postprocess/NormCalculator.h>
 #include <veamy/postprocess/utilities/NormResult.h>
+#include <veamy/config/ExecutionContextScope.h>
+#include <delynoi/utilities/parallel.h>
+#include <utilities/Profiler.h>
+#include <memory>
 
 template <typename T>
 NormCalculator<T>::NormCalculator(Eigen::VectorXd disp, DOFS dofs) {
@@ -9,18 +13,75 @@ NormCalculator<T>::NormCalculator(Eigen::VectorXd disp, DOFS dofs) {
 
 template <typename T>
 NormResult NormCalculator<T>::getNorm(Mesh<T> &mesh) {
-    double numerator = 0, denominator = 0;
-    std::vector<T> meshElements = mesh.getPolygons();
-    UniqueList<Point> points = mesh.getPoints();
-    std::vector<double> maxEdge;
+    PROFILE_PHASE("norm integration");
+    std::vector<T>& meshElements = mesh.getPolygons();
+    std::vector<Point>& points = mesh.getPoints().getList();
+    int n = (int) meshElements.size();
+
+    Computable<T>* numComputable = num->getComputable();
+    Computable<T>* denComputable = den->getComputable();
+    for(Computable<T>* computable: {numComputable, denComputable}){
+        if(computable!=nullptr){
+            computable->prepare(meshElements);
+        }
+    }
+
+    // Other threads integrate with copies of the computables; if one can not be copied, everything runs here
+    int threads = delynoi_utilities::numberOfThreads();
+    for(Computable<T>* computable: {numComputable, denComputable}){
+        if(computable!=nullptr){
+            std::unique_ptr<Computable<T>> copy(computable->clone());
+            if(copy==nullptr){
+                threads = 1;
+            }
+        }
+    }
+
+    std::vector<double> numerators(n), denominators(n), maxEdge(n);
+    DelynoiConfig* delynoiConfig = DelynoiConfig::instance();
+    VeamyConfig* veamyConfig = VeamyConfig::instance();
+    FeamyConfig* feamyConfig = FeamyConfig::instance();
+
+    delynoi_utilities::parallelFor(n, threads, [&](int begin, int end){
+        ExecutionContextScope scope(delynoiConfig, veamyConfig, feamyConfig);
 
-    int i = 0;
-    for(T elem: meshElements){
-        numerator += num->getIntegral(elem, i, points.getList());
-        denominator += den->getIntegral(elem, i, points.getList());
+        NormIntegrator<T>* numIntegrator = num;
+        NormIntegrator<T>* denIntegrator = den;
+        std::unique_ptr<NormIntegrator<T>> numCopy, denCopy;
+        std::unique_ptr<Computable<T>> numComputableCopy, denComputableCopy;
 
-        maxEdge.push_back(elem.getMaxDistance(points.getList()));
-        i++;
+        if(begin!=0){
+            numCopy.reset(num->clone());
+            denCopy.reset(den->clone());
+
+            if(numComputable!=nullptr){
+                numComputableCopy.reset(numComputable->clone());
+                numCopy->setComputable(numComputableCopy.get());
+            }
+            if(denComputable!=nullptr){
+                denComputableCopy.reset(denComputable->clone());
+                denCopy->setComputable(denComputableCopy.get());
+            }
+
+            numIntegrator = numCopy.get();
+            denIntegrator = denCopy.get();
+        }
+
+        for (int i = begin; i < end; ++i) {
+            T elem = meshElements[i];
+
+            numerators[i] = numIntegrator->getIntegral(elem, i, points);
+            denominators[i] = denIntegrator->getIntegral(elem, i, points);
+            maxEdge[i] = elem.getMaxDistance(points);
+        }
+
+    });
+
+    // The contributions are added in the order of the elements, so the result does not depend on the threads
+    double numerator = 0, denominator = 0;
+    for (int i = 0; i < n; ++i) {
+        numerator += numerators[i];
+        denominator += denominators[i];
     }
 
     return NormResult(std::sqrt(numerator/denominator), *std::min_element(maxEdge.begin(), maxEdge.end()));
@@ -2,8 +2,41 @@
 
 StrainValue::StrainValue(func_pair f) {
     this->f = f;
+    this->fBuffer = nullptr;
+    this->components = 0;
+}
+
+StrainValue::StrainValue(func_pair_buffer f, int components) {
+    this->f = nullptr;
+    this->fBuffer = f;
+    this->components = components;
 }
 
 std::vector<double> StrainValue::getValue(Point p) {
+    if(this->fBuffer!=nullptr){
+        std::vector<double> value(this->components);
+        this->fBuffer(p.getX(), p.getY(), value.data());
+
+        return value;
+    }
+
     return f(p.getX(), p.getY());
 }
+
+void StrainValue::getValues(const double *x, const double *y, int n, std::vector<double> &values) {
+    if(this->fBuffer!=nullptr){
+        values.resize(n*this->components);
+
+        for (int i = 0; i < n; ++i) {
+            this->fBuffer(x[i], y[i], values.data() + i*this->components);
+        }
+
+        return;
+    }
+
+    values.clear();
+    for (int i = 0; i < n; ++i) {
+        std::vector<double> value = f(x[i], y[i]);
+        values.insert(values.end(), value.begin(), value.end());
+    }
+}
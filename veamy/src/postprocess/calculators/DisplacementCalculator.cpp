@@ -7,5 +7,17 @@ DisplacementCalculator<T>::DisplacementCalculator(DOFS &d, Eigen::VectorXd &u) {
     this->nodalValues = u;
 }
 
+template <typename T>
+void DisplacementCalculator<T>::getDisplacements(const double *x, const double *y, int n, T &container,
+                                                 int containerIndex, std::vector<double> &values) {
+    setPolygonIndex(containerIndex);
+    values.clear();
+
+    for (int i = 0; i < n; ++i) {
+        std::vector<double> uH = getDisplacement(x[i], y[i], 0, container);
+        values.insert(values.end(), uH.begin(), uH.end());
+    }
+}
+
 template class DisplacementCalculator<Triangle>;
 template class DisplacementCalculator<Polygon>;
\ No newline at end of file
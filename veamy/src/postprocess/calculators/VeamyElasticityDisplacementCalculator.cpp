@@ -1,6 +1,8 @@
 #include <veamy/postprocess/calculators/VeamyElasticityDisplacementCalculator.h>
 #include <veamy/postprocess/utilities/norm_utilities.h>
 #include <veamy/problems/elasticity/elasticity_functions.h>
+#include <delynoi/utilities/parallel.h>
+#include <algorithm>
 
 template <typename T>
 VeamyElasticityDisplacementCalculator<T>::VeamyElasticityDisplacementCalculator(DOFS &d, Eigen::VectorXd &u,
@@ -37,5 +39,57 @@ std::vector<double> VeamyElasticityDisplacementCalculator<T>::getDisplacement(do
     return uH;
 }
 
+template <typename T>
+void VeamyElasticityDisplacementCalculator<T>::projection(T &container, double *values) {
+    Point average = container.getAverage(this->points);
+
+    Eigen::MatrixXd Wc = elasticity_functions::WcMatrix(container, this->points);
+    Eigen::VectorXd d =  norm_utilities::getElementNodalValues(container, this->nodalValues, this->dofs);
+
+    Eigen::VectorXd PiCGuH = Wc.transpose()*d;
+    Eigen::VectorXd PiRGuH = elasticity_functions::QMatrix(Wc).transpose()*d;
+    Eigen::VectorXd mean = norm_utilities::getAverage(d, 2);
+
+    double projection[9] = {average.getX(), average.getY(), PiCGuH(0), PiCGuH(1), PiCGuH(2), PiRGuH(0), PiRGuH(1),
+                            mean(0), mean(1)};
+    std::copy(projection, projection + 9, values);
+}
+
+template <typename T>
+void VeamyElasticityDisplacementCalculator<T>::prepare(std::vector<T> &elements) {
+    this->projections.clear();
+    this->setPreparedElements(elements);
+    this->projections.resize(9*elements.size());
+
+    delynoi_utilities::parallelFor((int) elements.size(), delynoi_utilities::numberOfThreads(),
+                                   [&](int begin, int end){
+        for (int i = begin; i < end; ++i) {
+            T container = elements[i];
+            projection(container, this->projections.data() + 9*i);
+        }
+    });
+}
+
+template <typename T>
+void VeamyElasticityDisplacementCalculator<T>::getDisplacements(const double *x, const double *y, int n, T &container,
+                                                                int containerIndex, std::vector<double> &values) {
+    double local[9];
+    const double* p = local;
+    if(this->isPrepared(container, containerIndex)){
+        p = this->projections.data() + 9*containerIndex;
+    } else {
+        projection(container, local);
+    }
+
+    // uH = PiC*(X-Xbar) + PiR*(X-Xbar) + mean, with PiC = [c0 c2; c2 c1] and PiR = [0 r0; r1 0]
+    values.resize(2*n);
+    for (int i = 0; i < n; ++i) {
+        double dx = x[i] - p[0], dy = y[i] - p[1];
+
+        values[2*i] = (p[2]*dx + p[4]*dy) + p[5]*dy + p[7];
+        values[2*i + 1] = (p[4]*dx + p[3]*dy) + p[6]*dx + p[8];
+    }
+}
+
 template class VeamyElasticityDisplacementCalculator<Triangle>;
 template class VeamyElasticityDisplacementCalculator<Polygon>;
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include <veamy/postprocess/calculators/VeamyElasticityStrainCalculator.h>
+#include <delynoi/utilities/parallel.h>
+#include <algorithm>
 #include <veamy/postprocess/utilities/norm_utilities.h>
 #include <veamy/problems/elasticity/elasticity_functions.h>
 
@@ -15,5 +17,41 @@ Eigen::VectorXd VeamyElasticityStrainCalculator<T>::getStrain(double x, double y
     return Wc.transpose()*d;
 }
 
+template <typename T>
+void VeamyElasticityStrainCalculator<T>::prepare(std::vector<T> &elements) {
+    this->strains.clear();
+    this->setPreparedElements(elements);
+    this->strains.resize(3*elements.size());
+
+    delynoi_utilities::parallelFor((int) elements.size(), delynoi_utilities::numberOfThreads(),
+                                   [&](int begin, int end){
+        for (int i = begin; i < end; ++i) {
+            T container = elements[i];
+            // The strain is constant in the element, so the point it is evaluated at does not matter
+            Eigen::VectorXd strain = getStrain(0, 0, container, i);
+
+            std::copy(strain.data(), strain.data() + 3, this->strains.begin() + 3*i);
+        }
+    });
+}
+
+template <typename T>
+void VeamyElasticityStrainCalculator<T>::getStrains(const double *x, const double *y, int n, T &container,
+                                                    int containerIndex, std::vector<double> &values) {
+    Eigen::VectorXd computed;
+    const double* strain;
+    if(this->isPrepared(container, containerIndex)){
+        strain = this->strains.data() + 3*containerIndex;
+    } else {
+        computed = getStrain(0, 0, container, containerIndex);
+        strain = computed.data();
+    }
+
+    values.resize(3*n);
+    for (int i = 0; i < n; ++i) {
+        std::copy(strain, strain + 3, values.begin() + 3*i);
+    }
+}
+
 template class VeamyElasticityStrainCalculator<Polygon>;
 template class VeamyElasticityStrainCalculator<Triangle>;
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include <veamy/postprocess/calculators/VeamyPoissonDisplacementCalculator.h>
 #include <veamy/problems/poisson/poisson_functions.h>
 #include <veamy/postprocess/utilities/norm_utilities.h>
+#include <delynoi/utilities/parallel.h>
+#include <algorithm>
 
 template <typename T>
 VeamyPoissonDisplacementCalculator<T>::VeamyPoissonDisplacementCalculator(DOFS &d, Eigen::VectorXd &u,
@@ -28,5 +30,51 @@ std::vector<double> VeamyPoissonDisplacementCalculator<T>::getDisplacement(doubl
     return uH;
 }
 
+template <typename T>
+void VeamyPoissonDisplacementCalculator<T>::projection(T &container, double *values) {
+    Point average = container.getAverage(this->points);
+
+    Eigen::MatrixXd W = poisson_functions::WMatrix(container, this->points);
+    Eigen::VectorXd d =  norm_utilities::getElementNodalValues(container, this->nodalValues, this->dofs);
+
+    Eigen::VectorXd gradient = W.transpose()*d;
+    Eigen::VectorXd mean = norm_utilities::getAverage(d, 1);
+
+    double projection[5] = {average.getX(), average.getY(), gradient(0), gradient(1), mean(0)};
+    std::copy(projection, projection + 5, values);
+}
+
+template <typename T>
+void VeamyPoissonDisplacementCalculator<T>::prepare(std::vector<T> &elements) {
+    this->projections.clear();
+    this->setPreparedElements(elements);
+    this->projections.resize(5*elements.size());
+
+    delynoi_utilities::parallelFor((int) elements.size(), delynoi_utilities::numberOfThreads(),
+                                   [&](int begin, int end){
+        for (int i = begin; i < end; ++i) {
+            T container = elements[i];
+            projection(container, this->projections.data() + 5*i);
+        }
+    });
+}
+
+template <typename T>
+void VeamyPoissonDisplacementCalculator<T>::getDisplacements(const double *x, const double *y, int n, T &container,
+                                                             int containerIndex, std::vector<double> &values) {
+    double local[5];
+    const double* p = local;
+    if(this->isPrepared(container, containerIndex)){
+        p = this->projections.data() + 5*containerIndex;
+    } else {
+        projection(container, local);
+    }
+
+    values.resize(n);
+    for (int i = 0; i < n; ++i) {
+        values[i] = p[2]*(x[i] - p[0]) + p[3]*(y[i] - p[1]) + p[4];
+    }
+}
+
 template class VeamyPoissonDisplacementCalculator<Triangle>;
 template class VeamyPoissonDisplacementCalculator<Polygon>;
\ No newline at end of file
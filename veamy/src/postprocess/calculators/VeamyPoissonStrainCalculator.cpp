@@ -1,4 +1,6 @@
 #include <veamy/postprocess/calculators/VeamyPoissonStrainCalculator.h>
+#include <delynoi/utilities/parallel.h>
+#include <algorithm>
 
 template <typename T>
 VeamyPoissonStrainCalculator<T>::VeamyPoissonStrainCalculator(DOFS &d, Eigen::VectorXd& u, std::vector<Point> &points)
@@ -12,5 +14,41 @@ Eigen::VectorXd VeamyPoissonStrainCalculator<T>::getStrain(double x, double y, T
     return W.transpose()*d;
 }
 
+template <typename T>
+void VeamyPoissonStrainCalculator<T>::prepare(std::vector<T> &elements) {
+    this->gradients.clear();
+    this->setPreparedElements(elements);
+    this->gradients.resize(2*elements.size());
+
+    delynoi_utilities::parallelFor((int) elements.size(), delynoi_utilities::numberOfThreads(),
+                                   [&](int begin, int end){
+        for (int i = begin; i < end; ++i) {
+            T container = elements[i];
+            // The gradient is constant in the element, so the point it is evaluated at does not matter
+            Eigen::VectorXd gradient = getStrain(0, 0, container, i);
+
+            std::copy(gradient.data(), gradient.data() + 2, this->gradients.begin() + 2*i);
+        }
+    });
+}
+
+template <typename T>
+void VeamyPoissonStrainCalculator<T>::getStrains(const double *x, const double *y, int n, T &container,
+                                                 int containerIndex, std::vector<double> &values) {
+    Eigen::VectorXd computed;
+    const double* gradient;
+    if(this->isPrepared(container, containerIndex)){
+        gradient = this->gradients.data() + 2*containerIndex;
+    } else {
+        computed = getStrain(0, 0, container, containerIndex);
+        gradient = computed.data();
+    }
+
+    values.resize(2*n);
+    for (int i = 0; i < n; ++i) {
+        std::copy(gradient, gradient + 2, values.begin() + 2*i);
+    }
+}
+
 template class VeamyPoissonStrainCalculator<Polygon>;
 template class VeamyPoissonStrainCalculator<Triangle>;
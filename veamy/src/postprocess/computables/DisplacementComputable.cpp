@@ -18,5 +18,27 @@ double DisplacementComputable<T>::apply(double x, double y, int index, T contain
     return result;
 }
 
+template <typename T>
+void DisplacementComputable<T>::applyBatch(const double *x, const double *y, int n, T &container, double *values) {
+    value->getValues(x, y, n, this->exact);
+    int components = n==0? 0 : (int) this->exact.size()/n;
+
+    for (int k = 0; k < n; ++k) {
+        const double* u = this->exact.data() + k*components;
+        double result = 0;
+
+        for (int i = 0; i < components; ++i) {
+            result += std::pow(u[i],2);
+        }
+
+        values[k] = result;
+    }
+}
+
+template <typename T>
+Computable<T> *DisplacementComputable<T>::clone() {
+    return new DisplacementComputable<T>(*this);
+}
+
 template class DisplacementComputable<Polygon>;
 template class DisplacementComputable<Triangle>;
\ No newline at end of file
@@ -27,5 +27,35 @@ void DisplacementDifferenceComputable<T>::setPolygonIndex(int polyIndex) {
     this->polygonIndex = polyIndex;
 }
 
+template <typename T>
+void DisplacementDifferenceComputable<T>::applyBatch(const double *x, const double *y, int n, T &container,
+                                                     double *values) {
+    value->getValues(x, y, n, this->exact);
+    calculator->getDisplacements(x, y, n, container, this->polygonIndex, this->approximate);
+    int components = n==0? 0 : (int) this->exact.size()/n;
+
+    for (int k = 0; k < n; ++k) {
+        const double* u = this->exact.data() + k*components;
+        const double* uH = this->approximate.data() + k*components;
+        double result = 0;
+
+        for (int i = 0; i < components; ++i) {
+            result += std::pow(u[i] - uH[i], 2);
+        }
+
+        values[k] = result;
+    }
+}
+
+template <typename T>
+void DisplacementDifferenceComputable<T>::prepare(std::vector<T> &elements) {
+    calculator->prepare(elements);
+}
+
+template <typename T>
+Computable<T> *DisplacementDifferenceComputable<T>::clone() {
+    return new DisplacementDifferenceComputable<T>(*this);
+}
+
 template class DisplacementDifferenceComputable<Polygon>;
 template class DisplacementDifferenceComputable<Triangle>;
\ No newline at end of file
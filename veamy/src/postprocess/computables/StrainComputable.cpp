@@ -16,5 +16,20 @@ double StrainComputable<T>::apply(double x, double y, int index, T container) {
     return value;
 }
 
+template <typename T>
+void StrainComputable<T>::applyBatch(const double *x, const double *y, int n, T &container, double *values) {
+    this->strainValue->getValues(x, y, n, this->exact);
+    int components = (int) this->D.rows();
+
+    for (int k = 0; k < n; ++k) {
+        values[k] = this->materialProduct(this->exact.data() + k*components);
+    }
+}
+
+template <typename T>
+Computable<T> *StrainComputable<T>::clone() {
+    return new StrainComputable<T>(*this);
+}
+
 template class StrainComputable<Polygon>;
 template class StrainComputable<Triangle>;
\ No newline at end of file
@@ -22,5 +22,27 @@ template <typename T>
 void StrainDifferenceComputable<T>::setPolygonIndex(int polyIndex) {
     this->polygonIndex = polyIndex;
 }
+template <typename T>
+void StrainDifferenceComputable<T>::applyBatch(const double *x, const double *y, int n, T &container,
+                                               double *values) {
+    this->calculator->getStrains(x, y, n, container, this->polygonIndex, this->approximate);
+    this->strainValue->getValues(x, y, n, this->exact);
+    int components = (int) this->D.rows();
+
+    // The exact values are overwritten with the error s - sH
+    for (int i = 0; i < n*components; ++i) {
+        this->exact[i] -= this->approximate[i];
+    }
+
+    for (int k = 0; k < n; ++k) {
+        values[k] = this->materialProduct(this->exact.data() + k*components);
+    }
+}
+
+template <typename T>
+Computable<T> *StrainDifferenceComputable<T>::clone() {
+    return new StrainDifferenceComputable<T>(*this);
+}
+
 template class StrainDifferenceComputable<Polygon>;
 template class StrainDifferenceComputable<Triangle>;
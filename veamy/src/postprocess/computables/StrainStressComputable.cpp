@@ -16,5 +16,27 @@ double StrainStressComputable<T>::apply(double x, double y, int index, T contain
     return veamy_functions::dot(stress, strain);
 }
 
+template <typename T>
+void StrainStressComputable<T>::applyBatch(const double *x, const double *y, int n, T &container, double *values) {
+    this->stressValue->getValues(x, y, n, this->exactStress);
+    this->strainValue->getValues(x, y, n, this->exact);
+    int components = n==0? 0 : (int) this->exact.size()/n;
+
+    for (int k = 0; k < n; ++k) {
+        double result = 0;
+
+        for (int i = 0; i < components; ++i) {
+            result += this->exactStress[k*components + i]*this->exact[k*components + i];
+        }
+
+        values[k] = result;
+    }
+}
+
+template <typename T>
+Computable<T> *StrainStressComputable<T>::clone() {
+    return new StrainStressComputable<T>(*this);
+}
+
 template class StrainStressComputable<Polygon>;
 template class StrainStressComputable<Triangle>;
\ No newline at end of file
@@ -25,5 +25,37 @@ void StrainStressDifferenceComputable<T>::setPolygonIndex(int polyIndex) {
     this->polygonIndex = polyIndex;
 }
 
+template <typename T>
+void StrainStressDifferenceComputable<T>::applyBatch(const double *x, const double *y, int n, T &container,
+                                                     double *values) {
+    this->calculator->getStrains(x, y, n, container, this->polygonIndex, this->approximate);
+    this->strainValue->getValues(x, y, n, this->exact);
+    this->stressValue->getValues(x, y, n, this->exactStress);
+    int components = (int) this->D.rows();
+
+    for (int k = 0; k < n; ++k) {
+        const double* eH = this->approximate.data() + k*components;
+        const double* e = this->exact.data() + k*components;
+        const double* s = this->exactStress.data() + k*components;
+        double result = 0;
+
+        for (int i = 0; i < components; ++i) {
+            double sH = 0;
+            for (int j = 0; j < components; ++j) {
+                sH += this->D(i,j)*eH[j];
+            }
+
+            result += (e[i] - eH[i])*(s[i] - sH);
+        }
+
+        values[k] = result;
+    }
+}
+
+template <typename T>
+Computable<T> *StrainStressDifferenceComputable<T>::clone() {
+    return new StrainStressDifferenceComputable<T>(*this);
+}
+
 template class StrainStressDifferenceComputable<Polygon>;
 template class StrainStressDifferenceComputable<Triangle>;
\ No newline at end of file
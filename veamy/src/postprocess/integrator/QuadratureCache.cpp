@@ -0,0 +1,168 @@
+#include <veamy/postprocess/integrator/QuadratureCache.h>
+#include <feamy/integration/quadrature/gauss_quadrature.h>
+#include <delynoi/triangulation/EarClipper.h>
+#include <delynoi/utilities/parallel.h>
+#include <utilities/Profiler.h>
+#include <algorithm>
+
+namespace {
+    /*
+     * Quadrature points of a contiguous block of elements
+     */
+    struct QuadratureBlock {
+        std::vector<int> trianglesPerElement;
+        std::vector<Triangle> triangles;
+        std::vector<double> x;
+        std::vector<double> y;
+        std::vector<double> w;
+    };
+
+    /* Maps the triangle rule to a triangle and appends the points to a block
+     * @param block block where the points are added
+     * @param rule triangle rule
+     * @param t triangle
+     * @param points points the triangle references
+     */
+    void addTriangle(QuadratureBlock& block, const gauss_quadrature::TriangleRule& rule, Triangle& t,
+                     std::vector<Point>& points){
+        Eigen::MatrixXd triangle = gauss_quadrature::trianglePoints(t, points);
+        double area = t.getArea(points);
+        std::size_t first = block.w.size();
+
+        block.x.resize(first + rule.size);
+        block.y.resize(first + rule.size);
+        block.w.resize(first + rule.size);
+        gauss_quadrature::map_triangle_rule(rule, triangle, area, block.x.data() + first, block.y.data() + first,
+                                            block.w.data() + first);
+    }
+}
+
+template <typename T>
+QuadratureCache<T>::QuadratureCache(Mesh<T> &mesh, int order, ElementTriangulation triangulation) {
+    PROFILE_PHASE("quadrature cache");
+    this->mesh = &mesh;
+    this->numberOfPolygons = (int) mesh.getPolygons().size();
+    this->numberOfPoints = mesh.getPoints().size();
+    this->order = order;
+    this->triangulation = triangulation;
+
+    gauss_quadrature::TriangleRule rule = gauss_quadrature::triangle_rule(order);
+    this->trianglePoints = rule.size;
+
+    std::vector<T>& polygons = mesh.getPolygons();
+    std::vector<Point>& points = mesh.getPoints().getList();
+    int n = this->numberOfPolygons;
+
+    // Each thread fills the block of its contiguous range of elements, so joining the blocks keeps the element order
+    int threads = std::max(1, std::min(delynoi_utilities::numberOfThreads(), n));
+    int blockSize = std::max(1, (n + threads - 1)/threads);
+    std::vector<QuadratureBlock> blocks(threads);
+
+    delynoi_utilities::parallelFor(n, threads, [&](int begin, int end){
+        QuadratureBlock& block = blocks[begin/blockSize];
+        EarClipper clipper;
+
+        for (int i = begin; i < end; ++i) {
+            T& poly = polygons[i];
+            int before = (int) block.w.size();
+
+            if(triangulation==ElementTriangulation::Ears){
+                for(Trio<int>& ear: clipper.triangulate(poly.getPoints(), points)){
+                    block.triangles.push_back(Triangle({ear.first, ear.second, ear.third}, points));
+                    addTriangle(block, rule, block.triangles.back(), points);
+                }
+            } else {
+                std::vector<Point> polygonPoints = poly.getPoints(points);
+                int m = (int) polygonPoints.size();
+                std::vector<Trio<int>> local;
+
+                if(poly.isConvex(points)){
+                    polygonPoints.push_back(poly.getAverage(points));
+                    for (int j = 0; j < m; ++j) {
+                        local.push_back(Trio<int>(j, (j + 1)%m, m));
+                    }
+                } else {
+                    std::vector<int> indexes(m);
+                    for (int j = 0; j < m; ++j) {
+                        indexes[j] = j;
+                    }
+                    local = clipper.triangulate(indexes, polygonPoints);
+                }
+
+                for(Trio<int>& indexes: local){
+                    Triangle t({indexes.first, indexes.second, indexes.third}, polygonPoints);
+                    addTriangle(block, rule, t, polygonPoints);
+                }
+            }
+
+            block.trianglesPerElement.push_back(rule.size==0? 0 : ((int) block.w.size() - before)/rule.size);
+        }
+    });
+
+    this->triangleOffsets.reserve(n + 1);
+    this->triangleOffsets.push_back(0);
+    for(QuadratureBlock& block: blocks){
+        for(int count: block.trianglesPerElement){
+            this->triangleOffsets.push_back(this->triangleOffsets.back() + count);
+        }
+
+        this->triangles.insert(this->triangles.end(), block.triangles.begin(), block.triangles.end());
+        this->x.insert(this->x.end(), block.x.begin(), block.x.end());
+        this->y.insert(this->y.end(), block.y.begin(), block.y.end());
+        this->w.insert(this->w.end(), block.w.begin(), block.w.end());
+    }
+}
+
+template <typename T>
+bool QuadratureCache<T>::isBuiltFor(Mesh<T> &mesh, int order, ElementTriangulation triangulation) const {
+    return this->mesh==&mesh && this->numberOfPolygons==mesh.getPolygons().size() &&
+           this->numberOfPoints==mesh.getPoints().size() && this->order==order && this->triangulation==triangulation;
+}
+
+template <typename T>
+int QuadratureCache<T>::pointsPerTriangle() const {
+    return this->trianglePoints;
+}
+
+template <typename T>
+int QuadratureCache<T>::firstTriangle(int element) const {
+    return this->triangleOffsets[element];
+}
+
+template <typename T>
+int QuadratureCache<T>::endTriangle(int element) const {
+    return this->triangleOffsets[element + 1];
+}
+
+template <typename T>
+int QuadratureCache<T>::firstPoint(int element) const {
+    return this->triangleOffsets[element]*this->trianglePoints;
+}
+
+template <typename T>
+int QuadratureCache<T>::endPoint(int element) const {
+    return this->triangleOffsets[element + 1]*this->trianglePoints;
+}
+
+template <typename T>
+const std::vector<Triangle>& QuadratureCache<T>::getTriangles() const {
+    return this->triangles;
+}
+
+template <typename T>
+const double* QuadratureCache<T>::getX() const {
+    return this->x.data();
+}
+
+template <typename T>
+const double* QuadratureCache<T>::getY() const {
+    return this->y.data();
+}
+
+template <typename T>
+const double* QuadratureCache<T>::getWeights() const {
+    return this->w.data();
+}
+
+template class QuadratureCache<Polygon>;
+template class QuadratureCache<Triangle>;
@@ -15,6 +15,23 @@ template <typename T>
 double VeamyIntegrator<T>::getIntegral(T poly, int polyIndex, std::vector<Point>& points) {
     this->computable->setPolygonIndex(polyIndex);
 
+    if(this->quadrature!=nullptr){
+        int first = this->quadrature->firstPoint(polyIndex);
+        int n = this->quadrature->endPoint(polyIndex) - first;
+        const double* w = this->quadrature->getWeights() + first;
+        double result = 0;
+
+        this->values.resize(n);
+        this->computable->applyBatch(this->quadrature->getX() + first, this->quadrature->getY() + first, n, poly,
+                                     this->values.data());
+
+        for (int i = 0; i < n; ++i) {
+            result += this->values[i]*w[i];
+        }
+
+        return result;
+    }
+
     FeamyConfig* config = FeamyConfig::instance();
     double result = veamy_functions::gauss_integration(poly, points, config->getNumberOfGaussPoints(), this->computable);
 
@@ -23,7 +40,10 @@ double VeamyIntegrator<T>::getIntegral(T poly, int polyIndex, std::vector<Point>
 
 template <typename T>
 NormIntegrator<T>* VeamyIntegrator<T>::clone() {
-    return new VeamyIntegrator<T>;
+    VeamyIntegrator<T>* integrator = new VeamyIntegrator<T>;
+    integrator->setQuadrature(this->quadrature);
+
+    return integrator;
 }
 
 template <typename T>
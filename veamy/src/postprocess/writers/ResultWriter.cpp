@@ -0,0 +1,72 @@
+#include <veamy/postprocess/writers/ResultWriter.h>
+#include <utilities/utilities.h>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+const int ResultWriter::BLOCK_SIZE;
+
+ResultWriter::ResultWriter(std::string fileName, ResultFormat format, int n_dofs, int numberOfPoints, int precision)
+        : writer(utilities::getPath() + fileName, format==ResultFormat::Binary) {
+    this->format = format;
+    this->n_dofs = n_dofs;
+    this->precision = precision;
+    this->closed = false;
+
+    if(format==ResultFormat::Binary){
+        writer.writeBinary((int32_t) numberOfPoints);
+        writer.writeBinary((int32_t) n_dofs);
+    }
+}
+
+ResultWriter::~ResultWriter() {}
+
+void ResultWriter::writeToFile(const NodeBlock &block) {
+    int n = block.size();
+
+    if(format==ResultFormat::Binary){
+        const double undefined = std::numeric_limits<double>::quiet_NaN();
+
+        for (int i = 0; i < n; ++i) {
+            if(block.defined[i]){
+                writer.writeRaw(&block.values[n_dofs*i], n_dofs*sizeof(double));
+            }else{
+                for (int j = 0; j < n_dofs; ++j) {
+                    writer.writeBinary(undefined);
+                }
+            }
+        }
+
+        return;
+    }
+
+    for (int i = 0; i < n; ++i) {
+        if(block.defined[i]){
+            writer.write(block.first + i);
+
+            for (int j = 0; j < n_dofs; ++j) {
+                writer.write(' ');
+                writer.writeFixed(block.values[n_dofs*i + j], precision);
+            }
+        }
+
+        writer.write('\n');
+    }
+}
+
+void ResultWriter::write(NodeBlock &block) {
+    if(closed){
+        throw std::invalid_argument("Can not write to a closed result writer");
+    }
+
+    writeToFile(block);
+}
+
+void ResultWriter::close() {
+    writer.close();
+    this->closed = true;
+}
+
+int ResultWriter::getNumberOfDOFS() {
+    return this->n_dofs;
+}
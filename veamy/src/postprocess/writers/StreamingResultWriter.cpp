@@ -0,0 +1,63 @@
+#include <veamy/postprocess/writers/StreamingResultWriter.h>
+#include <stdexcept>
+
+StreamingResultWriter::StreamingResultWriter(std::string fileName, ResultFormat format, int n_dofs,
+                                             int numberOfPoints, int precision, size_t maxQueued)
+        : ResultWriter(fileName, format, n_dofs, numberOfPoints, precision) {
+    this->maxQueued = maxQueued>0? maxQueued : 1;
+    this->finished = false;
+    this->worker = std::thread(&StreamingResultWriter::run, this);
+}
+
+StreamingResultWriter::~StreamingResultWriter() {
+    close();
+}
+
+void StreamingResultWriter::run() {
+    while(true){
+        NodeBlock block;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            notEmpty.wait(lock, [this]{ return !queue.empty() || finished; });
+
+            if(queue.empty()){
+                return;
+            }
+
+            block = std::move(queue.front());
+            queue.pop_front();
+        }
+        notFull.notify_one();
+
+        writeToFile(block);
+    }
+}
+
+void StreamingResultWriter::write(NodeBlock &block) {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if(finished){
+            throw std::invalid_argument("Can not write to a closed result writer");
+        }
+
+        notFull.wait(lock, [this]{ return queue.size() < maxQueued; });
+
+        queue.push_back(std::move(block));
+    }
+    notEmpty.notify_one();
+}
+
+void StreamingResultWriter::close() {
+    if(!worker.joinable()){
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished = true;
+    }
+    notEmpty.notify_one();
+
+    worker.join();
+    ResultWriter::close();
+}
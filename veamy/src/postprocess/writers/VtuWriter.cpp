@@ -0,0 +1,288 @@
+#include <veamy/postprocess/writers/VtuWriter.h>
+#include <utilities/BufferedWriter.h>
+#include <utilities/Profiler.h>
+#include <utilities/rle_deflate.h>
+#include <utilities/utilities.h>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+    /*
+     * Size of the blocks in which arrays are split before compression (same default as VTK)
+     */
+    const size_t COMPRESSION_BLOCK = 1 << 15;
+
+    /*
+     * VTK cell type identifiers
+     */
+    const unsigned char VTK_TRIANGLE = 5;
+    const unsigned char VTK_POLYGON = 7;
+
+    template <typename V>
+    void appendBytes(std::vector<unsigned char>& bytes, const V& value){
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(&value);
+        bytes.insert(bytes.end(), p, p + sizeof(V));
+    }
+
+    template <typename V>
+    std::vector<unsigned char> toBytes(const std::vector<V>& values){
+        std::vector<unsigned char> bytes(values.size()*sizeof(V));
+
+        if(!values.empty()){
+            std::memcpy(bytes.data(), values.data(), bytes.size());
+        }
+
+        return bytes;
+    }
+
+    bool isLittleEndian(){
+        uint16_t one = 1;
+        return *reinterpret_cast<unsigned char*>(&one) == 1;
+    }
+}
+
+template <typename T>
+VtuWriter<T>::VtuWriter(Mesh<T> &mesh, bool compressed) : mesh(mesh) {
+    this->compressed = compressed;
+}
+
+template <typename T>
+typename VtuWriter<T>::DataArray VtuWriter<T>::fromDoubles(std::string name, int components,
+                                                           const std::vector<double> &values) {
+    DataArray array;
+    array.name = name;
+    array.type = "Float64";
+    array.components = components;
+    array.bytes = toBytes(values);
+
+    return array;
+}
+
+template <typename T>
+void VtuWriter<T>::addPointField(std::string name, int components, const std::vector<double> &values) {
+    if(values.size() != (size_t) components*mesh.getPoints().size()){
+        throw std::invalid_argument("Point field " + name + " does not have one value per point and component");
+    }
+
+    pointFields.push_back(fromDoubles(name, components, values));
+}
+
+template <typename T>
+void VtuWriter<T>::addCellField(std::string name, int components, const std::vector<double> &values) {
+    if(values.size() != (size_t) components*mesh.getPolygons().size()){
+        throw std::invalid_argument("Cell field " + name + " does not have one value per element and component");
+    }
+
+    cellFields.push_back(fromDoubles(name, components, values));
+}
+
+template <typename T>
+void VtuWriter<T>::addDisplacements(DOFS &dofs, Eigen::VectorXd &u, std::string name) {
+    int n_dofs = dofs.getNumberOfDOFS();
+    int components = n_dofs==2? 3 : n_dofs;
+
+    std::vector<double> values(components*mesh.getPoints().size(), 0.0);
+
+    for (int k = 0; k < u.rows(); k = k + n_dofs) {
+        int point_index = dofs.get(k).pointIndex();
+
+        for (int j = 0; j < n_dofs; ++j) {
+            values[components*point_index + j] = u[k + j];
+        }
+    }
+
+    addPointField(name, components, values);
+}
+
+template <typename T>
+void VtuWriter<T>::addStrainAndStress(StrainCalculator<T> *calculator, Material *material) {
+    std::vector<T>& polygons = mesh.getPolygons();
+    std::vector<Point>& points = mesh.getPoints().getList();
+
+    std::vector<double> strainValues, stressValues;
+    int components = 0;
+
+    Eigen::MatrixXd D;
+    if(material != nullptr){
+        D = material->getMaterialMatrix();
+    }
+
+    for (int i = 0; i < polygons.size(); ++i) {
+        Point centroid = polygons[i].getCentroid(points);
+        Eigen::VectorXd strain = calculator->getStrain(centroid.getX(), centroid.getY(), polygons[i], i);
+        components = (int) strain.size();
+
+        for (int j = 0; j < components; ++j) {
+            strainValues.push_back(strain(j));
+        }
+
+        if(material != nullptr && D.cols()==components){
+            Eigen::VectorXd stress = D*strain;
+
+            for (int j = 0; j < stress.size(); ++j) {
+                stressValues.push_back(stress(j));
+            }
+        }
+    }
+
+    if(polygons.empty()){
+        return;
+    }
+
+    addCellField("Strain", components, strainValues);
+
+    if(!stressValues.empty()){
+        addCellField("Stress", (int) (stressValues.size()/polygons.size()), stressValues);
+    }
+}
+
+template <typename T>
+void VtuWriter<T>::encode(DataArray &array, std::vector<unsigned char> &out) {
+    if(!compressed){
+        appendBytes(out, (uint64_t) array.bytes.size());
+        out.insert(out.end(), array.bytes.begin(), array.bytes.end());
+        return;
+    }
+
+    size_t total = array.bytes.size();
+    size_t blocks = (total + COMPRESSION_BLOCK - 1)/COMPRESSION_BLOCK;
+
+    std::vector<std::vector<unsigned char>> compressedBlocks(blocks);
+    for (size_t b = 0; b < blocks; ++b) {
+        size_t start = b*COMPRESSION_BLOCK;
+        size_t size = std::min(COMPRESSION_BLOCK, total - start);
+
+        rle_deflate::compress(array.bytes.data() + start, size, compressedBlocks[b]);
+    }
+
+    appendBytes(out, (uint64_t) blocks);
+    appendBytes(out, (uint64_t) COMPRESSION_BLOCK);
+    appendBytes(out, (uint64_t) (total % COMPRESSION_BLOCK));
+
+    for (size_t b = 0; b < blocks; ++b) {
+        appendBytes(out, (uint64_t) compressedBlocks[b].size());
+    }
+
+    for (size_t b = 0; b < blocks; ++b) {
+        out.insert(out.end(), compressedBlocks[b].begin(), compressedBlocks[b].end());
+    }
+}
+
+template <typename T>
+void VtuWriter<T>::write(std::string fileName) {
+    PROFILE_PHASE("output");
+    UniqueList<Point>& points = mesh.getPoints();
+    std::vector<T>& polygons = mesh.getPolygons();
+
+    std::vector<double> coordinates;
+    coordinates.reserve(3*points.size());
+    for (int i = 0; i < points.size(); ++i) {
+        coordinates.push_back(points[i].getX());
+        coordinates.push_back(points[i].getY());
+        coordinates.push_back(0.0);
+    }
+
+    std::vector<int64_t> connectivity, offsets;
+    std::vector<unsigned char> types;
+    offsets.reserve(polygons.size());
+    types.reserve(polygons.size());
+
+    for (int i = 0; i < polygons.size(); ++i) {
+        std::vector<int>& polygonPoints = polygons[i].getPoints();
+
+        connectivity.insert(connectivity.end(), polygonPoints.begin(), polygonPoints.end());
+        offsets.push_back((int64_t) connectivity.size());
+        types.push_back(polygonPoints.size()==3? VTK_TRIANGLE : VTK_POLYGON);
+    }
+
+    std::vector<DataArray> geometry(4);
+    geometry[0] = fromDoubles("Points", 3, coordinates);
+    geometry[1].name = "connectivity";
+    geometry[1].type = "Int64";
+    geometry[1].components = 1;
+    geometry[1].bytes = toBytes(connectivity);
+    geometry[2].name = "offsets";
+    geometry[2].type = "Int64";
+    geometry[2].components = 1;
+    geometry[2].bytes = toBytes(offsets);
+    geometry[3].name = "types";
+    geometry[3].type = "UInt8";
+    geometry[3].components = 1;
+    geometry[3].bytes = types;
+
+    std::vector<DataArray*> arrays;
+    for(DataArray& a: pointFields) arrays.push_back(&a);
+    for(DataArray& a: cellFields) arrays.push_back(&a);
+    for(DataArray& a: geometry) arrays.push_back(&a);
+
+    std::vector<std::vector<unsigned char>> encoded(arrays.size());
+    std::vector<uint64_t> arrayOffsets(arrays.size());
+    uint64_t offset = 0;
+
+    for (int i = 0; i < arrays.size(); ++i) {
+        encode(*arrays[i], encoded[i]);
+        arrayOffsets[i] = offset;
+        offset += encoded[i].size();
+    }
+
+    auto dataArrayTag = [&](int i, bool named) {
+        std::string tag = "        <DataArray type=\"" + arrays[i]->type + "\"";
+
+        if(named){
+            tag += " Name=\"" + arrays[i]->name + "\"";
+        }
+
+        tag += " NumberOfComponents=\"" + utilities::toString(arrays[i]->components) + "\" format=\"appended\"" +
+               " offset=\"" + utilities::toString(arrayOffsets[i]) + "\"/>\n";
+        return tag;
+    };
+
+    BufferedWriter writer(utilities::getPath() + fileName, true);
+
+    writer.write(std::string("<?xml version=\"1.0\"?>\n"));
+    writer.write("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" +
+                 std::string(isLittleEndian()? "LittleEndian" : "BigEndian") + "\" header_type=\"UInt64\"" +
+                 (compressed? " compressor=\"vtkZLibDataCompressor\"" : "") + ">\n");
+    writer.write(std::string("  <UnstructuredGrid>\n"));
+    writer.write("    <Piece NumberOfPoints=\"" + utilities::toString(points.size()) + "\" NumberOfCells=\"" +
+                 utilities::toString(polygons.size()) + "\">\n");
+
+    int index = 0;
+    writer.write(std::string("      <PointData>\n"));
+    for (int i = 0; i < pointFields.size(); ++i, ++index) {
+        writer.write(dataArrayTag(index, true));
+    }
+    writer.write(std::string("      </PointData>\n"));
+
+    writer.write(std::string("      <CellData>\n"));
+    for (int i = 0; i < cellFields.size(); ++i, ++index) {
+        writer.write(dataArrayTag(index, true));
+    }
+    writer.write(std::string("      </CellData>\n"));
+
+    writer.write(std::string("      <Points>\n"));
+    writer.write(dataArrayTag(index++, false));
+    writer.write(std::string("      </Points>\n"));
+
+    writer.write(std::string("      <Cells>\n"));
+    for (int i = 0; i < 3; ++i, ++index) {
+        writer.write(dataArrayTag(index, true));
+    }
+    writer.write(std::string("      </Cells>\n"));
+
+    writer.write(std::string("    </Piece>\n"));
+    writer.write(std::string("  </UnstructuredGrid>\n"));
+    writer.write(std::string("  <AppendedData encoding=\"raw\">\n   _"));
+
+    for (int i = 0; i < encoded.size(); ++i) {
+        writer.writeRaw(encoded[i].data(), encoded[i].size());
+    }
+
+    writer.write(std::string("\n  </AppendedData>\n"));
+    writer.write(std::string("</VTKFile>\n"));
+    writer.close();
+}
+
+template class VtuWriter<Polygon>;
+template class VtuWriter<Triangle>;
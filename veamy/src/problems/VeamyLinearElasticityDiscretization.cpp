@@ -75,13 +75,19 @@ Mesh<Polygon> VeamyLinearElasticityDiscretization::initProblemFromFile(std::stri
 
     infile.close();
 
+    // Reordered once the constraints, which refer to the points by their index in the file, have been read
+    mesh.reorder(DelynoiConfig::instance()->getMeshOrdering());
+
     return mesh;
 }
 
 NormResult VeamyLinearElasticityDiscretization::computeErrorNorm(NormCalculator<Polygon> *calculator,
                                                                  Mesh<Polygon>& mesh, Veamer* v) {
     CalculatorConstructor<Polygon>* constructor = new ElasticityConstructor<Polygon>(v->DOFs, calculator->getNodalDisplacements());
-    calculator->setCalculator(new VeamyIntegrator<Polygon>, constructor, mesh.getPoints().getList());
+    VeamyIntegrator<Polygon>* integrator = new VeamyIntegrator<Polygon>;
+    integrator->setQuadrature(v->getQuadrature(mesh, ElementTriangulation::Center));
+
+    calculator->setCalculator(integrator, constructor, mesh.getPoints().getList());
     calculator->setExtraInformation(this->conditions);
 
     return calculator->getNorm(mesh);
@@ -48,13 +48,19 @@ Mesh<Polygon> VeamyPoissonDiscretization::initProblemFromFile(std::string fileNa
     }
 
     infile.close();
+
+    // Reordered once the constraints, which refer to the points by their index in the file, have been read
+    mesh.reorder(DelynoiConfig::instance()->getMeshOrdering());
     return mesh;
 }
 
 NormResult
 VeamyPoissonDiscretization::computeErrorNorm(NormCalculator<Polygon> *calculator, Mesh<Polygon>& mesh, Veamer *solver) {
     CalculatorConstructor<Polygon>* constructor = new PoissonConstructor<Polygon>(solver->DOFs, calculator->getNodalDisplacements());
-    calculator->setCalculator(new VeamyIntegrator<Polygon>, constructor, mesh.getPoints().getList());
+    VeamyIntegrator<Polygon>* integrator = new VeamyIntegrator<Polygon>;
+    integrator->setQuadrature(solver->getQuadrature(mesh, ElementTriangulation::Center));
+
+    calculator->setCalculator(integrator, constructor, mesh.getPoints().getList());
 
     calculator->setExtraInformation(this->conditions);
 
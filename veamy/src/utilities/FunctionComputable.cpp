@@ -8,3 +8,13 @@ FunctionComputable::FunctionComputable(func f) {
 double FunctionComputable::apply(double x, double y, int index, Polygon container) {
     return f(x, y);
 }
+
+void FunctionComputable::applyBatch(const double *x, const double *y, int n, Polygon &container, double *values) {
+    for (int i = 0; i < n; ++i) {
+        values[i] = f(x[i], y[i]);
+    }
+}
+
+Computable<Polygon> *FunctionComputable::clone() {
+    return new FunctionComputable(*this);
+}